@@ -0,0 +1,149 @@
+#include "Compilation.h"
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ParseContext.h"
+#include "Semantic/Semantic.h"
+#include "Semantic/Jar.h"
+#include "Semantic/Parallel.h"
+#include "Semantic/RuntimeLibrary.h"
+
+namespace
+{
+    // How a source is named in the errors
+    std::string Describe(SourceText const& source) { return source.Name().empty() ? "the source" : source.Name(); }
+
+    // One program with the usings and the namespaces of all, a namespace declared several times gets
+    // the classes and the enums of every declaration. A class or an enum declared twice in a namespace,
+    // in one source or in two, is an error naming the sources
+    Program* MergePrograms(std::vector<ParseContext> const& contexts, std::vector<SourceText> const& sources,
+                           std::set<std::string>& errors)
+    {
+        struct MergedNamespace
+        {
+            NamespaceDeclNode* Node;
+            // The source each class and enum name comes from
+            std::unordered_map<std::string_view, size_t> TypeSources;
+        };
+
+        auto* usings = UsingDirectives::MakeEmpty();
+        auto* namespaces = NamespaceDeclSeq::MakeEmpty();
+        std::unordered_map<Symbol, MergedNamespace> namespacesByName;
+        for (size_t i = 0; i < contexts.size(); ++i)
+        {
+            for (auto* using_ : contexts[i].Root->Usings->GetSeq()) { usings->Add(using_); }
+            for (auto* namespace_ : contexts[i].Root->Namespaces->GetSeq())
+            {
+                auto [found, isNew] = namespacesByName.try_emplace(namespace_->NamespaceName,
+                                                                   MergedNamespace{ namespace_, {} });
+                auto& merged = found->second;
+                const auto declare = [&](const std::string_view name)
+                {
+                    const auto [previous, isFirst] = merged.TypeSources.try_emplace(name, i);
+                    if (isFirst)
+                        return;
+                    const auto type = ToString(namespace_->NamespaceName) + "." + std::string{ name };
+                    errors.insert(previous->second == i
+                                      ? type + " is declared twice in " + Describe(sources[i])
+                                      : type + " is declared in both " + Describe(sources[previous->second])
+                                        + " and " + Describe(sources[i]));
+                };
+                for (auto* class_ : namespace_->Members->Classes) { declare(class_->ClassName); }
+                for (auto* enum_ : namespace_->Members->Enums) { declare(enum_->EnumName); }
+                if (isNew)
+                {
+                    namespaces->Add(namespace_);
+                    continue;
+                }
+                auto* members = merged.Node->Members;
+                auto const& classes = namespace_->Members->Classes;
+                auto const& enums = namespace_->Members->Enums;
+                members->Classes.insert(members->Classes.end(), classes.begin(), classes.end());
+                members->Enums.insert(members->Enums.end(), enums.begin(), enums.end());
+            }
+        }
+        return new Program(usings, namespaces);
+    }
+}
+
+CompilationResult Compile(const std::string_view source, CompileOptions const& options)
+{
+    std::vector<SourceText> sources;
+    sources.push_back(SourceText::Copy(source));
+    return Compile(sources, options);
+}
+
+CompilationResult Compile(std::vector<SourceText>& sources, CompileOptions const& options)
+{
+    CompilationResult result;
+    if (sources.empty())
+    {
+        result.Errors.insert("No sources to compile");
+        return result;
+    }
+
+    // Each source is parsed into its own arena, they are all freed when the compilation ends
+    std::vector<ParseContext> contexts(sources.size());
+    std::vector<char> parsed(sources.size());
+    ParallelFor(sources.size(), options.Jobs, [&](const size_t i)
+    {
+        parsed[i] = ParseSource(sources[i].ScanBuffer(), sources[i].ScanBufferSize(), contexts[i]);
+    });
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        if (parsed[i])
+            continue;
+        const auto prefix = sources[i].Name().empty() ? std::string{} : sources[i].Name() + ": ";
+        for (auto const& error : contexts[i].Errors) { result.Errors.insert(prefix + error); }
+        if (contexts[i].Errors.empty()) { result.Errors.insert(prefix + "Syntax error"); }
+    }
+    if (!result.Errors.empty())
+        return result;
+
+    // The merged program and the nodes the analysis adds go to the arena of the first source
+    NodeArena::Scope arenaScope{ contexts.front().Arena };
+    auto* const root = MergePrograms(contexts, sources, result.Errors);
+    if (!result.Errors.empty())
+        return result;
+
+    if (options.OnTree) { options.OnTree(root, "TreeBeforeSemantic"); }
+    Semantic semantic(root);
+    semantic.Analyze();
+    if (options.OnTree) { options.OnTree(root, "TreeAfterSemantic"); }
+    result.Errors = semantic.Errors;
+    if (!result.Errors.empty())
+        return result;
+
+    semantic.Peephole = options.Peephole;
+    semantic.Jobs = options.Jobs;
+    result.Classes = semantic.Generate();
+    result.MainClass = semantic.AllMains.front()->Class->ToDataType().ToTypename();
+    result.CodeLengthBeforePeephole = semantic.CodeLengthBeforePeephole;
+    result.CodeLength = semantic.CodeLength;
+    return result;
+}
+
+void WriteJar(std::ostream& out, CompilationResult const& result, const bool deflate, const unsigned jobs)
+{
+    const auto manifest = MakeManifest(result.MainClass);
+    std::vector<Bytes> runtime;
+    for (auto const& runtimeClass : RuntimeClasses())
+        runtime.emplace_back(runtimeClass.Data, runtimeClass.Data + runtimeClass.Size);
+
+    std::vector<std::pair<std::string, const Bytes*>> files;
+    files.emplace_back("META-INF/MANIFEST.MF", &manifest);
+    for (auto const& [name, classFile] : result.Classes) { files.emplace_back(name + ".class", &classFile); }
+    for (size_t i = 0; i < runtime.size(); ++i) { files.emplace_back(RuntimeClasses()[i].Name, &runtime[i]); }
+
+    std::vector<JarEntry> entries(files.size());
+    ParallelFor(files.size(), jobs, [&](const size_t i)
+    {
+        entries[i] = JarEntry::Make(std::move(files[i].first), *files[i].second, deflate);
+    });
+
+    JarWriter jar{ out };
+    for (auto const& entry : entries) { jar.Add(entry); }
+    jar.Finish();
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <functional>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "SourceText.h"
+#include "Tree/Program.h"
+#include "Semantic/ByteWriter.h"
+#include "Semantic/Peephole.h"
+
+struct CompileOptions
+{
+    PeepholeOptions Peephole{};
+    // Threads parsing the sources and generating class files
+    unsigned Jobs = 1;
+    // Called with the syntax tree before and after the semantic analysis,
+    // the stage is "TreeBeforeSemantic" or "TreeAfterSemantic". The tree is freed when Compile returns
+    std::function<void(Program* tree, std::string_view stage)> OnTree;
+};
+
+struct CompilationResult
+{
+    // Syntax and semantic errors. There are no classes if there are any errors
+    std::set<std::string> Errors;
+    // Class files by internal name, like ns/Class
+    std::map<std::string, Bytes> Classes;
+    // Internal name of the class with Main
+    std::string MainClass;
+    // Code bytes of all generated methods before and after the peephole pass
+    size_t CodeLengthBeforePeephole = 0;
+    size_t CodeLength = 0;
+};
+
+// Compiles the source text into class files in memory, nothing is read from or written to disk.
+// Compilations share nothing but the interned symbols, so several of them can run on different threads
+[[nodiscard]] CompilationResult Compile(std::string_view source, CompileOptions const& options = {});
+
+// Compiles several sources as one program: they are parsed on `Jobs` threads, and the namespaces declared
+// in several of them are merged, in the order of the sources. The lexer scans the texts in place
+[[nodiscard]] CompilationResult Compile(std::vector<SourceText>& sources, CompileOptions const& options = {});
+
+// Writes a runnable jar: a manifest naming the main class, the classes and the System runtime.
+// Entries are compressed on `jobs` threads unless deflate is off
+void WriteJar(std::ostream& out, CompilationResult const& result, bool deflate = true, unsigned jobs = 1);
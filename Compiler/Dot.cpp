@@ -281,8 +281,11 @@ void ToDot(const VarDeclNode* node, std::ostream& out)
 void ToDot(WhileNode* node, std::ostream& out)
 {
     out << MakeNode(node->Id, node->Name());
-    ToDot(node->Condition, out);
-    out << MakeConnection(node->Id, node->Condition->Id, "Condition");
+    if (node->Condition)
+    {
+        ToDot(node->Condition, out);
+        out << MakeConnection(node->Id, node->Condition->Id, "Condition");
+    }
     ToDot(node->Body, out);
     out << MakeConnection(node->Id, node->Body->Id, "Body");
 }
@@ -290,8 +293,11 @@ void ToDot(WhileNode* node, std::ostream& out)
 void ToDot(DoWhileNode* node, std::ostream& out)
 {
     out << MakeNode(node->Id, node->Name());
-    ToDot(node->Condition, out);
-    out << MakeConnection(node->Id, node->Condition->Id, "Condition");
+    if (node->Condition)
+    {
+        ToDot(node->Condition, out);
+        out << MakeConnection(node->Id, node->Condition->Id, "Condition");
+    }
     ToDot(node->Body, out);
     out << MakeConnection(node->Id, node->Body->Id, "Body");
 }
@@ -441,7 +447,7 @@ void ToDot(MethodDeclNode* node, std::ostream& out)
 {
     const auto name = std::string{ node->Name() }
                       + "\\nVisibility: " + std::string{ ToString(node->Visibility) }
-                      + "\\nName: " + node->Identifier();
+                      + "\\nName: " + ToString(node->Identifier());
     out << MakeNode(node->Id, name);
 
     if (node->Type)
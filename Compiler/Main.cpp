@@ -1,16 +1,22 @@
-#include <cstdio>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
+#include <set>
 #include <fstream>
 #include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
-#include "Parser.tab.h"
+#include "Compilation.h"
 #include "Dot.h"
-#include "Semantic/Semantic.h"
+#include "ParseContext.h"
 
-extern FILE* yyin;
-struct Program* treeRoot;
-
-void MakeTreeImage(std::string_view filename)
+void MakeTreeImage(Program* tree, std::string_view filename)
 {
     {
         std::cout << "Generating dot file for " << filename << std::endl;
@@ -20,35 +26,246 @@ void MakeTreeImage(std::string_view filename)
         {
             std::fstream treeOut;
             treeOut.open(dotFile, std::ios_base::out);
-            ToDot(treeRoot, treeOut);
+            ToDot(tree, treeOut);
         }
         std::cout << "Generating picture" << std::endl;
         RunDot("../ThirdParty/Bin/dot/dot.exe", dotFile.string());
     }
 }
 
+// Writes Output/<namespace>/<class>.class, each file with a single write
+void WriteClassFiles(CompilationResult const& result)
+{
+    using namespace std::filesystem;
+    const auto outputPath = current_path() / "Output";
+    // Classes are sorted by name, so the classes of a namespace come one after another
+    path createdDirectory;
+    for (auto const& [name, classFile] : result.Classes)
+    {
+        const auto filepath = outputPath / (name + ".class");
+        if (filepath.parent_path() != createdDirectory)
+        {
+            createdDirectory = filepath.parent_path();
+            create_directories(createdDirectory);
+        }
+        std::ofstream out{ filepath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc };
+        out.write((const char*)classFile.data(), (std::streamsize)classFile.size());
+    }
+}
+
+// `*` stands for any run of characters and `?` for any one character
+bool MatchesWildcard(const std::string_view name, const std::string_view pattern)
+{
+    size_t n = 0;
+    size_t p = 0;
+    // Where the last star is in the pattern and where in the name its run ends, to go back to on a mismatch
+    auto star = std::string_view::npos;
+    size_t starEnd = 0;
+    while (n < name.size())
+    {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n]))
+        {
+            ++n;
+            ++p;
+        }
+        else if (p < pattern.size() && pattern[p] == '*')
+        {
+            star = p++;
+            starEnd = n;
+        }
+        else if (star != std::string_view::npos)
+        {
+            p = star + 1;
+            n = ++starEnd;
+        }
+        else { return false; }
+    }
+    while (p < pattern.size() && pattern[p] == '*') { ++p; }
+    return p == pattern.size();
+}
+
+// Adds the sources an argument names: the file itself, every .cs file under a directory, the files that match
+// a wildcard in the last part of the path, or whatever the lines of a @response file name.
+// The files of a directory or a wildcard are sorted, so the order of the classes does not depend on the file system
+void AddSources(const std::string& argument, std::vector<std::string>& files)
+{
+    using namespace std::filesystem;
+    if (argument.size() > 1 && argument.front() == '@')
+    {
+        std::ifstream list{ argument.substr(1) };
+        if (!list)
+            throw std::runtime_error{ "Cannot open response file " + argument.substr(1) };
+        for (std::string line; std::getline(list, line);)
+        {
+            while (!line.empty() && std::isspace((unsigned char)line.back())) { line.pop_back(); }
+            if (!line.empty()) { AddSources(line, files); }
+        }
+        return;
+    }
+
+    std::vector<std::string> found;
+    const path argumentPath = argument;
+    if (is_directory(argumentPath))
+    {
+        for (auto const& entry : recursive_directory_iterator{ argumentPath })
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ".cs")
+                found.push_back(entry.path().string());
+        }
+    }
+    else if (const auto pattern = argumentPath.filename().string();
+        pattern.find_first_of("*?") != std::string::npos)
+    {
+        const auto directory = argumentPath.has_parent_path() ? argumentPath.parent_path() : path{ "." };
+        for (auto const& entry : directory_iterator{ directory })
+        {
+            if (entry.is_regular_file() && MatchesWildcard(entry.path().filename().string(), pattern))
+                found.push_back(entry.path().string());
+        }
+        if (found.empty())
+            throw std::runtime_error{ "No files match " + argument };
+    }
+    else
+    {
+        files.push_back(argument);
+        return;
+    }
+    std::sort(found.begin(), found.end());
+    files.insert(files.end(), found.begin(), found.end());
+}
+
+// Scans each source without parsing it and prints how fast the lexer went
+void MeasureLexer(std::vector<SourceText>& sources)
+{
+    size_t totalBytes = 0;
+    std::chrono::steady_clock::duration totalTime{};
+    for (auto& source : sources)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto tokens = ScanTokens(source.ScanBuffer(), source.ScanBufferSize());
+        const auto time = std::chrono::steady_clock::now() - start;
+        const auto seconds = std::chrono::duration<double>{ time }.count();
+        const auto megabytes = (double)source.Text().size() / (1024 * 1024);
+        std::cout << (source.Name().empty() ? "<stdin>" : source.Name()) << ": " << tokens << " tokens, "
+                  << megabytes << " MB in " << seconds * 1000 << " ms, " << megabytes / seconds << " MB/s" << std::endl;
+        totalBytes += source.Text().size();
+        totalTime += time;
+    }
+    if (sources.size() > 1)
+    {
+        const auto megabytes = (double)totalBytes / (1024 * 1024);
+        std::cout << "Total: " << megabytes << " MB, "
+                  << megabytes / std::chrono::duration<double>{ totalTime }.count() << " MB/s" << std::endl;
+    }
+}
+
 int main(const int argc, char** argv)
 {
-    if (argc > 1)
+    std::vector<std::string> sourceArguments;
+    PeepholeOptions peephole{};
+    unsigned jobs = 1;
+    std::string jarPath;
+    bool jarDeflate = true;
+    bool lexOnly = false;
+    for (auto i = 1; i < argc; ++i)
     {
-        std::cout << "Opening file " << argv[1] << std::endl;
-        const auto errorCode = fopen_s(&yyin, argv[1], "r");
+        const std::string_view argument = argv[i];
+        constexpr std::string_view peepholeRules = "--peephole=";
+        if (argument == "--no-peephole") { peephole = PeepholeOptions::None(); }
+        else if (argument == "--jar")
+        {
+            if (i + 1 == argc)
+            {
+                std::cout << "Expected a file name after --jar" << std::endl;
+                return 1;
+            }
+            jarPath = argv[++i];
+        }
+        else if (argument == "--jar-stored") { jarDeflate = false; }
+        else if (argument == "--lex-only") { lexOnly = true; }
+        else if (argument == "-j")
+        {
+            // -j 0 takes a thread per core
+            const auto value = i + 1 < argc ? std::strtol(argv[++i], nullptr, 10) : -1;
+            if (value < 0)
+            {
+                std::cout << "Expected a number of threads after -j" << std::endl;
+                return 1;
+            }
+            jobs = value == 0 ? std::thread::hardware_concurrency() : (unsigned)value;
+        }
+        else if (argument.substr(0, peepholeRules.size()) == peepholeRules)
+        {
+            if (!ParsePeepholeRules(argument.substr(peepholeRules.size()), peephole))
+            {
+                std::cout << "Unknown peephole rule in " << argument
+                          << ", expected a list of nops, constants, jumps, loads, stores, threads" << std::endl;
+                return 1;
+            }
+        }
+        else { sourceArguments.emplace_back(argv[i]); }
     }
-    else { yyin = stdin; }
 
-    std::cout << "Building syntax tree" << std::endl;
-    yyparse();
+    // Without file arguments the source is read from the standard input
+    std::vector<SourceText> sources;
+    try
+    {
+        std::vector<std::string> sourceFiles;
+        for (auto const& argument : sourceArguments) { AddSources(argument, sourceFiles); }
+        // A file named twice, say by a wildcard and by itself, is compiled once
+        std::set<std::filesystem::path> seen;
+        sourceFiles.erase(std::remove_if(sourceFiles.begin(), sourceFiles.end(), [&](std::string const& file)
+        {
+            return !seen.insert(std::filesystem::weakly_canonical(file)).second;
+        }), sourceFiles.end());
+        if (sourceFiles.size() == 1) { std::cout << "Opening file " << sourceFiles.front() << std::endl; }
+        else if (sourceFiles.size() > 1) { std::cout << "Opening " << sourceFiles.size() << " files" << std::endl; }
+        for (auto const& file : sourceFiles) { sources.push_back(SourceText::FromFile(file)); }
+        if (sourceArguments.empty()) { sources.push_back(SourceText::FromStream(std::cin)); }
+    }
+    catch (std::runtime_error const& error)
+    {
+        std::cout << error.what() << std::endl;
+        return 1;
+    }
 
-    MakeTreeImage("TreeBeforeSemantic.dot");
+    if (lexOnly)
+    {
+        MeasureLexer(sources);
+        return 0;
+    }
 
-    Semantic semantic(treeRoot);
-    semantic.Analyze();
+    CompileOptions options;
+    options.Peephole = peephole;
+    options.Jobs = jobs;
+    options.OnTree = [](Program* tree, std::string_view stage)
+    {
+        MakeTreeImage(tree, std::string{ stage } + ".dot");
+    };
+    std::cout << "Building syntax tree" << std::endl;
+    const auto result = Compile(sources, options);
 
     std::cout << std::endl << "Errors: " << std::endl;
-    for (auto const& error : semantic.Errors) { std::cout << error << std::endl; }
+    for (auto const& error : result.Errors) { std::cout << error << std::endl; }
     std::cout << std::endl;
+    if (!result.Errors.empty())
+        return 1;
 
-    MakeTreeImage("TreeAfterSemantic.dot");
-
-    semantic.Generate();
+    if (jarPath.empty()) { WriteClassFiles(result); }
+    else
+    {
+        std::ofstream out{ jarPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc };
+        if (!out)
+        {
+            std::cout << "Cannot open " << jarPath << " for writing" << std::endl;
+            return 1;
+        }
+        WriteJar(out, result, jarDeflate, jobs);
+    }
+    if (result.CodeLengthBeforePeephole != 0)
+    {
+        std::cout << "Peephole optimization saved "
+                  << result.CodeLengthBeforePeephole - result.CodeLength << " of "
+                  << result.CodeLengthBeforePeephole << " code bytes" << std::endl;
+    }
 }
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Tree/NodeArena.h"
+#include "Tree/Program.h"
+
+// Everything one parse produces. The scanner and the parser keep the rest of their state on the stack,
+// so several sources can be parsed on different threads at once, each into its own context
+struct ParseContext
+{
+    // Owns the nodes of the tree
+    NodeArena Arena;
+    // Set once the whole source is parsed
+    Program* Root = nullptr;
+    // Syntax errors with their lines. They are kept instead of printed, as other sources may be parsed at the same time
+    std::vector<std::string> Errors;
+};
+
+// Parses the buffer, laid out as SourceText::ScanBuffer gives it, into the context.
+// The nodes are allocated in the context's arena. Returns false on a syntax error
+[[nodiscard]] bool ParseSource(char* buffer, size_t size, ParseContext& context);
+
+// Runs the scanner alone over the buffer, laid out the same, and returns the number of tokens. For measuring the lexer
+[[nodiscard]] size_t ScanTokens(char* buffer, size_t size);
@@ -10,29 +10,49 @@
 
 #include <cstdio>
 #include <iostream>
+#include <string>
 
+#include "ParseContext.h"
 #include "Tree/Program.h"
 
-void __cdecl yyerror(const char* s) {
-	std::cerr << s << std::endl;
-}
-
 template <char Separator = ' ', typename... Args>
 void Print(Args&&... args) {
     ((std::cout << args << Separator), ...);
     std::cout << std::endl;
 }
-
-int yylex();
-int yyparse();
-extern FILE* yyin;
-extern struct Program* treeRoot;
 %}
 
+%code requires {
+#include "Tree/Symbol.h"
+
+struct ParseContext;
+
+// Same as in the scanner flex generates, its state is passed around as this
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+}
+
+%code {
+int yylex(YYSTYPE* yylval, yyscan_t scanner);
+int yyget_lineno(yyscan_t scanner);
+
+void __cdecl yyerror(yyscan_t scanner, ParseContext& context, const char* s) {
+	context.Errors.push_back("Line " + std::to_string(yyget_lineno(scanner)) + ": " + s);
+}
+}
+
+// Nothing is kept in globals, each parse has its own scanner and context
+%define api.pure full
+%param { yyscan_t scanner }
+%parse-param { ParseContext& context }
+
 %union {
     int _integer;
-    char* _string;
-    char* _identifier;
+    // Interned texts, see Symbol
+    const Symbol::Entry* _string;
+    const Symbol::Entry* _identifier;
     double _floatingPoint;
     char _character;
 
@@ -172,7 +192,7 @@ extern struct Program* treeRoot;
 
 %%
 
-program: using_directives_optional namespace_decl_seq { treeRoot = new Program($1, $2); }
+program: using_directives_optional namespace_decl_seq { context.Root = new Program($1, $2); }
 ;
 
 access_expr:  '(' expr ')'                                                  { $$ = AccessExpr::FromExpr($2); }
@@ -348,7 +368,7 @@ enumerators: IDENTIFIER                     { $$ = new IdentifierList(); $$ -> A
             | enumerators ',' IDENTIFIER    { $$ -> Add($3); }
 ;
 
-enum_decl: PUBLIC ENUM IDENTIFIER '{' enumerators '}' { Print("Found enum declaration with name:", $3); }
+enum_decl: PUBLIC ENUM IDENTIFIER '{' enumerators '}' { $$ = new EnumDeclNode(Symbol{ $3 }, $5); Print("Found enum declaration with name:", Symbol{ $3 }); }
 
 class_decl: PUBLIC CLASS IDENTIFIER '{' class_members_optional '}'                  { $$ = new ClassDeclNode($3, nullptr, $5); }
           | PUBLIC CLASS IDENTIFIER ':' using_arg '{' class_members_optional '}'    { $$ = new ClassDeclNode($3, $5, $7); }
@@ -0,0 +1,210 @@
+#include "Prescanner.h"
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PRESCANNER_VECTORS 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PRESCANNER_VECTORS 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+#ifdef PRESCANNER_VECTORS
+#ifdef __AVX2__
+    using Vector = __m256i;
+    constexpr ptrdiff_t Width = 32;
+    constexpr uint32_t AllLanes = 0xFFFFFFFF;
+
+    Vector Load(const char* position) { return _mm256_loadu_si256((const Vector*)position); }
+    Vector Splat(const char c) { return _mm256_set1_epi8(c); }
+    Vector Equal(const Vector a, const Vector b) { return _mm256_cmpeq_epi8(a, b); }
+    Vector Either(const Vector a, const Vector b) { return _mm256_or_si256(a, b); }
+    Vector Subtract(const Vector a, const Vector b) { return _mm256_sub_epi8(a, b); }
+    Vector Minimum(const Vector a, const Vector b) { return _mm256_min_epu8(a, b); }
+    uint32_t Mask(const Vector v) { return (uint32_t)_mm256_movemask_epi8(v); }
+#else
+    using Vector = __m128i;
+    constexpr ptrdiff_t Width = 16;
+    constexpr uint32_t AllLanes = 0xFFFF;
+
+    Vector Load(const char* position) { return _mm_loadu_si128((const Vector*)position); }
+    Vector Splat(const char c) { return _mm_set1_epi8(c); }
+    Vector Equal(const Vector a, const Vector b) { return _mm_cmpeq_epi8(a, b); }
+    Vector Either(const Vector a, const Vector b) { return _mm_or_si128(a, b); }
+    Vector Subtract(const Vector a, const Vector b) { return _mm_sub_epi8(a, b); }
+    Vector Minimum(const Vector a, const Vector b) { return _mm_min_epu8(a, b); }
+    uint32_t Mask(const Vector v) { return (uint32_t)_mm_movemask_epi8(v); }
+#endif
+
+    // Bytes from low to low + count - 1, compared as unsigned
+    Vector InRange(const Vector v, const char low, const char count)
+    {
+        const auto offset = Subtract(v, Splat(low));
+        return Equal(Minimum(offset, Splat((char)(count - 1))), offset);
+    }
+
+    unsigned LowestLane(const uint32_t lanes)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, lanes);
+        return index;
+#else
+        return (unsigned)__builtin_ctz(lanes);
+#endif
+    }
+#endif
+
+    // Character classes, the same as in the flex rules. Matches tests a byte, Lanes marks the bytes of a block
+    struct Whitespace
+    {
+        static bool Matches(const char c) { return c == ' ' || (uint8_t)(c - '\t') <= '\r' - '\t'; }
+#ifdef PRESCANNER_VECTORS
+        static uint32_t Lanes(const Vector v) { return Mask(Either(Equal(v, Splat(' ')), InRange(v, '\t', 5))); }
+#endif
+    };
+
+    struct IdentifierCharacter
+    {
+        static bool Matches(const char c)
+        {
+            return (uint8_t)(c - '0') <= 9 || (uint8_t)((c | 0x20) - 'a') <= 'z' - 'a' || c == '_';
+        }
+#ifdef PRESCANNER_VECTORS
+        static uint32_t Lanes(const Vector v)
+        {
+            const auto letters = InRange(Either(v, Splat(0x20)), 'a', 26);
+            return Mask(Either(Either(InRange(v, '0', 10), letters), Equal(v, Splat('_'))));
+        }
+#endif
+    };
+
+    struct StringLiteralEnd
+    {
+        static bool Matches(const char c) { return c == '"' || c == '\\' || c == '\n'; }
+#ifdef PRESCANNER_VECTORS
+        static uint32_t Lanes(const Vector v)
+        {
+            return Mask(Either(Either(Equal(v, Splat('"')), Equal(v, Splat('\\'))), Equal(v, Splat('\n'))));
+        }
+#endif
+    };
+
+    template <char C>
+    struct Character
+    {
+        static bool Matches(const char c) { return c == C; }
+#ifdef PRESCANNER_VECTORS
+        static uint32_t Lanes(const Vector v) { return Mask(Equal(v, Splat(C))); }
+#endif
+    };
+
+    // Most runs between tokens are a few bytes long, a single space or none, so the first bytes are looked at
+    // one by one before loading a block
+    constexpr ptrdiff_t ScalarPrefix = 4;
+
+    const char* PrefixEnd(const char* const position, const char* const end)
+    {
+        return position + std::min(ScalarPrefix, end - position);
+    }
+
+    // First position with a byte of the class, or with a byte out of it if Outside is set
+    template <typename Class, bool Outside = false>
+    const char* FindFirst(const char* position, const char* const end)
+    {
+        for (const auto* const prefixEnd = PrefixEnd(position, end); position != prefixEnd; ++position)
+        {
+            if (Class::Matches(*position) != Outside)
+                return position;
+        }
+#ifdef PRESCANNER_VECTORS
+        for (; end - position >= Width; position += Width)
+        {
+            auto lanes = Class::Lanes(Load(position));
+            if constexpr (Outside)
+                lanes = ~lanes & AllLanes;
+            if (lanes != 0)
+                return position + LowestLane(lanes);
+        }
+#endif
+        while (position != end && Class::Matches(*position) == Outside) { ++position; }
+        return position;
+    }
+
+    int CountNewlines(const char* position, const char* const end)
+    {
+        int count = 0;
+#ifdef PRESCANNER_VECTORS
+        for (; end - position >= Width; position += Width)
+            count += (int)std::bitset<32>{ Character<'\n'>::Lanes(Load(position)) }.count();
+#endif
+        for (; position != end; ++position) { count += *position == '\n'; }
+        return count;
+    }
+}
+
+// The newlines are counted in the same blocks as the whitespace, so the text is read once
+const char* SkipWhitespace(const char* position, const char* const end, int& lines)
+{
+    for (const auto* const prefixEnd = PrefixEnd(position, end); position != prefixEnd; ++position)
+    {
+        if (!Whitespace::Matches(*position))
+            return position;
+        lines += *position == '\n';
+    }
+#ifdef PRESCANNER_VECTORS
+    for (; end - position >= Width; position += Width)
+    {
+        const auto block = Load(position);
+        const auto newlines = Character<'\n'>::Lanes(block);
+        const auto others = ~Whitespace::Lanes(block) & AllLanes;
+        if (others != 0)
+        {
+            // Only the newlines in the lanes before the first other byte
+            lines += (int)std::bitset<32>{ newlines & ((others & (0u - others)) - 1) }.count();
+            return position + LowestLane(others);
+        }
+        lines += (int)std::bitset<32>{ newlines }.count();
+    }
+#endif
+    for (; position != end && Whitespace::Matches(*position); ++position) { lines += *position == '\n'; }
+    return position;
+}
+
+const char* FindLineEnd(const char* const position, const char* const end)
+{
+    return FindFirst<Character<'\n'>>(position, end);
+}
+
+const char* SkipCommentBody(const char* const position, const char* const end, int& lines)
+{
+    for (auto* star = FindFirst<Character<'*'>>(position, end); end - star >= 2;
+         star = FindFirst<Character<'*'>>(star + 1, end))
+    {
+        if (star[1] == '/')
+        {
+            lines += CountNewlines(position, star);
+            return star + 2;
+        }
+    }
+    return nullptr;
+}
+
+const char* SkipIdentifierCharacters(const char* const position, const char* const end)
+{
+    return FindFirst<IdentifierCharacter, true>(position, end);
+}
+
+const char* FindStringLiteralEnd(const char* const position, const char* const end)
+{
+    return FindFirst<StringLiteralEnd>(position, end);
+}
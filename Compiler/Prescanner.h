@@ -0,0 +1,21 @@
+#pragma once
+
+// Fast paths of the lexer over the runs of the source that need no token rules: whitespace, comment bodies,
+// identifiers and string literals without escapes. They look at 32 bytes at a time with AVX2, 16 with SSE2
+// and one otherwise. Each function takes the text as [position, end) and never reads past end
+
+// First character that is not whitespace. The newlines skipped are added to lines
+[[nodiscard]] const char* SkipWhitespace(const char* position, const char* end, int& lines);
+
+// The newline that ends a // comment, or end
+[[nodiscard]] const char* FindLineEnd(const char* position, const char* end);
+
+// Past the */ that closes a comment with the body starting at position, or nullptr if it is never closed.
+// The newlines skipped are added to lines
+[[nodiscard]] const char* SkipCommentBody(const char* position, const char* end, int& lines);
+
+// First character that cannot go on an identifier: not a letter, a digit or an underscore
+[[nodiscard]] const char* SkipIdentifierCharacters(const char* position, const char* end);
+
+// First quote, backslash or newline. The literal has no escapes if it is a quote
+[[nodiscard]] const char* FindStringLiteralEnd(const char* position, const char* end);
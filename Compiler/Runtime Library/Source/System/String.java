@@ -48,4 +48,9 @@ public class String {
     public int IndexOf(String str) {
         return strVal.indexOf(str.strVal);
     }
+
+    @Override
+    public java.lang.String toString() {
+        return strVal;
+    }
 }
\ No newline at end of file
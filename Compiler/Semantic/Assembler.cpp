@@ -0,0 +1,585 @@
+#include "Assembler.h"
+#include "ClassAnalyzer.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    constexpr auto MaxCodeLength = 65535;
+    constexpr auto JumpLength = 3;
+    constexpr auto WideJumpLength = 5;
+
+    size_t OperandsLength(const Command command)
+    {
+        switch (command) // NOLINT(clang-diagnostic-switch-enum)
+        {
+            case Command::bipush:
+            case Command::ldc:
+            case Command::iload:
+            case Command::aload:
+            case Command::istore:
+            case Command::astore:
+            case Command::newarray:
+                return 1;
+            case Command::sipush:
+            case Command::ldc_w:
+            case Command::iinc:
+            case Command::new_:
+            case Command::anewarray:
+            case Command::getstatic:
+            case Command::putstatic:
+            case Command::getfield:
+            case Command::putfield:
+            case Command::instanceof:
+            case Command::checkcast:
+            case Command::invokevirtual:
+            case Command::invokespecial:
+            case Command::invokestatic:
+                return 2;
+            case Command::tableswitch:
+            case Command::lookupswitch:
+                throw std::runtime_error{ "Internal error: switch instructions are not supported by the assembler" };
+            default:
+                return 0;
+        }
+    }
+
+    constexpr auto MaxShortFormSlot = 3;
+
+    bool IsLocalVariableAccess(const Command command)
+    {
+        return command == Command::iload || command == Command::aload ||
+               command == Command::istore || command == Command::astore;
+    }
+
+    // The one-byte slot and increment of iinc, iload and the others only reach so far, beyond that they take wide
+    bool NeedsWide(Instruction const& instruction)
+    {
+        if (instruction.Opcode == Command::iinc)
+        {
+            return instruction.Operand > std::numeric_limits<uint8_t>::max() ||
+                   instruction.SecondOperand < std::numeric_limits<int8_t>::min() ||
+                   instruction.SecondOperand > std::numeric_limits<int8_t>::max();
+        }
+        return IsLocalVariableAccess(instruction.Opcode) && instruction.Operand > std::numeric_limits<uint8_t>::max();
+    }
+
+    bool HasShortForm(Instruction const& instruction)
+    {
+        return IsLocalVariableAccess(instruction.Opcode) && instruction.Operand <= MaxShortFormSlot;
+    }
+
+    // iload_<n>, aload_<n>, istore_<n> and astore_<n> for the slots 0..3
+    Command ShortForm(Instruction const& instruction)
+    {
+        auto first = Command::iload_0;
+        switch (instruction.Opcode) // NOLINT(clang-diagnostic-switch-enum)
+        {
+            case Command::aload:
+                first = Command::aload_0;
+                break;
+            case Command::istore:
+                first = Command::istore_0;
+                break;
+            case Command::astore:
+                first = Command::astore_0;
+                break;
+            default: ;
+        }
+        return (Command)((uint8_t)first + instruction.Operand);
+    }
+
+    // ldc takes a one-byte constant index, a constant further in the pool is loaded with ldc_w
+    bool NeedsLdcW(Instruction const& instruction)
+    {
+        return instruction.Opcode == Command::ldc && instruction.Operand > std::numeric_limits<uint8_t>::max();
+    }
+
+    // Local variable instructions and ldc are kept with their generic opcode and the slot number or constant index,
+    // the shortest encoding is picked only when the code is laid out
+    size_t InstructionLength(Instruction const& instruction)
+    {
+        if (HasShortForm(instruction))
+            return 1;
+        if (NeedsWide(instruction))
+            return instruction.Opcode == Command::iinc ? 6 : 4;
+        if (NeedsLdcW(instruction))
+            return 1 + OperandsLength(Command::ldc_w);
+        return 1 + OperandsLength(instruction.Opcode);
+    }
+
+    bool FitsInt16(const int64_t value)
+    {
+        return value >= std::numeric_limits<int16_t>::min() && value <= std::numeric_limits<int16_t>::max();
+    }
+
+    // Stack slots taken by a value whose type descriptor starts with typeDescriptor
+    int SlotsOf(const char typeDescriptor)
+    {
+        switch (typeDescriptor)
+        {
+            case 'V':
+                return 0;
+            case 'J':
+            case 'D':
+                return 2;
+            default:
+                return 1;
+        }
+    }
+
+    // Pushed return value minus popped arguments, not counting the receiver
+    int InvokeStackEffect(const std::string_view descriptor)
+    {
+        auto effect = 0;
+        size_t i = 1;
+        while (descriptor[i] != ')')
+        {
+            effect -= SlotsOf(descriptor[i]);
+            while (descriptor[i] == '[')
+                ++i;
+            if (descriptor[i] == 'L')
+                i = descriptor.find(';', i);
+            ++i;
+        }
+        return effect + SlotsOf(descriptor[i + 1]);
+    }
+}
+
+LabelT Assembler::CreateLabel()
+{
+    LabelPositions.push_back(UnboundLabel);
+    return (LabelT)(LabelPositions.size() - 1);
+}
+
+void Assembler::Bind(const LabelT label)
+{
+    LabelPositions[label] = Instructions.size();
+}
+
+void Assembler::Emit(const Command command, const int32_t operand, const int32_t secondOperand)
+{
+    Instructions.push_back({ command, operand, secondOperand });
+}
+
+void Assembler::EmitJump(const Command command, const LabelT target)
+{
+    Instructions.push_back({ command, 0, 0, target });
+}
+
+void Assembler::RemoveUnreachable()
+{
+    std::vector<bool> isReachable(Instructions.size());
+    std::vector<size_t> worklist;
+    const auto reach = [&](const size_t index)
+    {
+        if (index < Instructions.size() && !isReachable[index])
+        {
+            isReachable[index] = true;
+            worklist.push_back(index);
+        }
+    };
+
+    reach(0);
+    while (!worklist.empty())
+    {
+        const auto index = worklist.back();
+        worklist.pop_back();
+        if (IsJump(Instructions[index].Opcode))
+            reach(LabelPositions[Instructions[index].Target]);
+        if (!EndsFlow(Instructions[index].Opcode))
+            reach(index + 1);
+    }
+
+    // From here on the flags mark the instructions to drop
+    isReachable.flip();
+    Remove(isReachable);
+}
+
+void Assembler::Remove(std::vector<bool> const& isRemoved)
+{
+    // Every old position maps to the first kept instruction at or after it, which keeps labels valid
+    std::vector<size_t> newPositions(Instructions.size() + 1);
+    size_t kept = 0;
+    for (size_t i = 0; i < Instructions.size(); ++i)
+    {
+        newPositions[i] = kept;
+        if (!isRemoved[i])
+            Instructions[kept++] = Instructions[i];
+    }
+    newPositions[Instructions.size()] = kept;
+    Instructions.resize(kept);
+
+    for (auto& position : LabelPositions)
+    {
+        if (position != UnboundLabel)
+            position = newPositions[position];
+    }
+}
+
+std::vector<size_t> Assembler::Layout(std::vector<bool>& isWide) const
+{
+    for (const auto& instruction : Instructions)
+    {
+        if (IsJump(instruction.Opcode) && LabelPositions[instruction.Target] == UnboundLabel)
+            throw std::runtime_error{ "Internal error: jump to an unbound label" };
+    }
+
+    // Start with every jump short and lengthen the ones that do not reach their target.
+    // Lengthening only moves code apart, so the loop ends once no jump changes
+    isWide.assign(Instructions.size(), false);
+    std::vector<size_t> offsets(Instructions.size() + 1);
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        size_t offset = 0;
+        for (size_t i = 0; i < Instructions.size(); ++i)
+        {
+            offsets[i] = offset;
+            const auto command = Instructions[i].Opcode;
+            if (!IsJump(command))
+                offset += InstructionLength(Instructions[i]);
+            else if (!isWide[i])
+                offset += JumpLength;
+            else
+                offset += command == Command::goto_ ? WideJumpLength : JumpLength + WideJumpLength;
+        }
+        offsets[Instructions.size()] = offset;
+
+        for (size_t i = 0; i < Instructions.size(); ++i)
+        {
+            if (!IsJump(Instructions[i].Opcode) || isWide[i])
+                continue;
+            const auto target = offsets[LabelPositions[Instructions[i].Target]];
+            if (!FitsInt16((int64_t)target - (int64_t)offsets[i]))
+            {
+                isWide[i] = true;
+                changed = true;
+            }
+        }
+    }
+    return offsets;
+}
+
+size_t Assembler::Length() const
+{
+    std::vector<bool> isWide;
+    return Layout(isWide).back();
+}
+
+std::vector<size_t> Assembler::Assemble(ByteWriter& code) const
+{
+    std::vector<bool> isWide;
+    const auto offsets = Layout(isWide);
+    const auto codeLength = offsets[Instructions.size()];
+    if (codeLength > MaxCodeLength)
+        throw std::runtime_error{ "Method code is " + std::to_string(codeLength) + " bytes long, the limit is 65535" };
+
+    code.Reserve(codeLength);
+    for (size_t i = 0; i < Instructions.size(); ++i)
+    {
+        const auto& instruction = Instructions[i];
+        if (IsJump(instruction.Opcode))
+        {
+            const auto target = (int32_t)offsets[LabelPositions[instruction.Target]];
+            const auto offset = (int32_t)offsets[i];
+            if (!isWide[i])
+            {
+                code.Write(instruction.Opcode);
+                code.WriteI2((int16_t)(target - offset));
+            }
+            else if (instruction.Opcode == Command::goto_)
+            {
+                code.Write(Command::goto_w);
+                code.WriteI4(target - offset);
+            }
+            else
+            {
+                // Skip the following goto_w when the original condition is false
+                code.Write(InvertCondition(instruction.Opcode));
+                code.WriteI2((int16_t)(JumpLength + WideJumpLength));
+                code.Write(Command::goto_w);
+                code.WriteI4(target - (offset + JumpLength));
+            }
+            continue;
+        }
+
+        if (HasShortForm(instruction))
+        {
+            code.Write(ShortForm(instruction));
+            continue;
+        }
+        if (NeedsWide(instruction))
+        {
+            code.Write(Command::wide);
+            code.Write(instruction.Opcode);
+            code.WriteU2((uint16_t)instruction.Operand);
+            if (instruction.Opcode == Command::iinc)
+                code.WriteI2((int16_t)instruction.SecondOperand);
+            continue;
+        }
+        if (NeedsLdcW(instruction))
+        {
+            code.Write(Command::ldc_w);
+            code.WriteU2((uint16_t)instruction.Operand);
+            continue;
+        }
+
+        code.Write(instruction.Opcode);
+        switch (OperandsLength(instruction.Opcode))
+        {
+            case 1:
+                code.Write((uint8_t)instruction.Operand);
+                break;
+            case 2:
+                if (instruction.Opcode == Command::iinc)
+                {
+                    code.Write((uint8_t)instruction.Operand);
+                    code.Write((uint8_t)instruction.SecondOperand);
+                }
+                else { code.WriteU2((uint16_t)instruction.Operand); }
+                break;
+            default: ;
+        }
+    }
+    return offsets;
+}
+
+uint16_t Assembler::ComputeMaxStack(ConstantTable const& constants) const
+{
+    constexpr auto notReached = -1;
+    std::vector<int> depths(Instructions.size(), notReached);
+    std::vector<size_t> worklist;
+
+    const auto reach = [&](const size_t index, const int depth)
+    {
+        if (index >= Instructions.size())
+            throw std::runtime_error{ "Internal error: control flow runs past the end of the method" };
+        if (depths[index] == notReached)
+        {
+            depths[index] = depth;
+            worklist.push_back(index);
+        }
+        else if (depths[index] != depth)
+        {
+            throw std::runtime_error{ "Internal error: operand stack depth differs between paths to instruction "
+                                      + std::to_string(index) };
+        }
+    };
+
+    auto maxDepth = 0;
+    if (!Instructions.empty())
+        reach(0, 0);
+    while (!worklist.empty())
+    {
+        const auto index = worklist.back();
+        worklist.pop_back();
+
+        const auto& instruction = Instructions[index];
+        const auto depth = depths[index] + StackEffect(instruction, constants);
+        if (depth < 0)
+            throw std::runtime_error{ "Internal error: operand stack underflow at instruction " + std::to_string(index) };
+        maxDepth = std::max(maxDepth, depth);
+
+        if (IsJump(instruction.Opcode))
+            reach(LabelPositions[instruction.Target], depth);
+        if (!EndsFlow(instruction.Opcode))
+            reach(index + 1, depth);
+    }
+
+    if (maxDepth > std::numeric_limits<uint16_t>::max())
+        throw std::runtime_error{ "Method needs more than 65535 operand stack slots" };
+    return (uint16_t)maxDepth;
+}
+
+bool IsJump(const Command command)
+{
+    switch (command) // NOLINT(clang-diagnostic-switch-enum)
+    {
+        case Command::ifeq:
+        case Command::ifne:
+        case Command::iflt:
+        case Command::ifge:
+        case Command::ifgt:
+        case Command::ifle:
+        case Command::if_icmpeq:
+        case Command::if_icmpne:
+        case Command::if_icmplt:
+        case Command::if_icmpge:
+        case Command::if_icmpgt:
+        case Command::if_icmple:
+        case Command::if_acmpeq:
+        case Command::if_acmpne:
+        case Command::ifnull:
+        case Command::ifnonnull:
+        case Command::goto_:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Command InvertCondition(const Command command)
+{
+    switch (command) // NOLINT(clang-diagnostic-switch-enum)
+    {
+        case Command::ifeq:
+            return Command::ifne;
+        case Command::ifne:
+            return Command::ifeq;
+        case Command::iflt:
+            return Command::ifge;
+        case Command::ifge:
+            return Command::iflt;
+        case Command::ifgt:
+            return Command::ifle;
+        case Command::ifle:
+            return Command::ifgt;
+        case Command::if_icmpeq:
+            return Command::if_icmpne;
+        case Command::if_icmpne:
+            return Command::if_icmpeq;
+        case Command::if_icmplt:
+            return Command::if_icmpge;
+        case Command::if_icmpge:
+            return Command::if_icmplt;
+        case Command::if_icmpgt:
+            return Command::if_icmple;
+        case Command::if_icmple:
+            return Command::if_icmpgt;
+        case Command::if_acmpeq:
+            return Command::if_acmpne;
+        case Command::if_acmpne:
+            return Command::if_acmpeq;
+        case Command::ifnull:
+            return Command::ifnonnull;
+        case Command::ifnonnull:
+            return Command::ifnull;
+        default:
+            throw std::runtime_error{ "Internal error: cannot invert a non-conditional jump" };
+    }
+}
+
+std::string_view RefDescriptor(ConstantTable const& constants, const int32_t refId)
+{
+    const auto& ref = constants.Constants[refId - 1];
+    const auto& nameAndType = constants.Constants[ref.NameAndTypeId - 1];
+    return constants.Constants[nameAndType.TypeId - 1].Utf8;
+}
+
+bool EndsFlow(const Command command)
+{
+    switch (command) // NOLINT(clang-diagnostic-switch-enum)
+    {
+        case Command::goto_:
+        case Command::goto_w:
+        case Command::tableswitch:
+        case Command::lookupswitch:
+        case Command::ireturn:
+        case Command::areturn:
+        case Command::return_:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int StackEffect(Instruction const& instruction, ConstantTable const& constants)
+{
+    switch (instruction.Opcode)
+    {
+        case Command::nop:
+        case Command::iinc:
+        case Command::ineg:
+        case Command::goto_:
+        case Command::goto_w:
+        case Command::newarray:
+        case Command::anewarray:
+        case Command::arraylength:
+        case Command::instanceof:
+        case Command::checkcast:
+        case Command::return_:
+            return 0;
+        case Command::aconst_null:
+        case Command::iconst_m1:
+        case Command::iconst_0:
+        case Command::iconst_1:
+        case Command::iconst_2:
+        case Command::iconst_3:
+        case Command::iconst_4:
+        case Command::iconst_5:
+        case Command::bipush:
+        case Command::sipush:
+        case Command::ldc:
+        case Command::ldc_w:
+        case Command::iload:
+        case Command::aload:
+        case Command::aload_0:
+        case Command::dup:
+        case Command::new_:
+            return 1;
+        case Command::dup2:
+            return 2;
+        case Command::istore:
+        case Command::astore:
+        case Command::pop:
+        case Command::iadd:
+        case Command::isub:
+        case Command::imul:
+        case Command::idiv:
+        case Command::iaload:
+        case Command::aaload:
+        case Command::baload:
+        case Command::caload:
+        case Command::ifeq:
+        case Command::ifne:
+        case Command::iflt:
+        case Command::ifge:
+        case Command::ifgt:
+        case Command::ifle:
+        case Command::ifnull:
+        case Command::ifnonnull:
+        case Command::tableswitch:
+        case Command::lookupswitch:
+        case Command::ireturn:
+        case Command::areturn:
+            return -1;
+        case Command::if_icmpeq:
+        case Command::if_icmpne:
+        case Command::if_icmplt:
+        case Command::if_icmpge:
+        case Command::if_icmpgt:
+        case Command::if_icmple:
+        case Command::if_acmpeq:
+        case Command::if_acmpne:
+            return -2;
+        case Command::iastore:
+        case Command::aastore:
+        case Command::bastore:
+        case Command::castore:
+            return -3;
+        case Command::getstatic:
+            return SlotsOf(RefDescriptor(constants, instruction.Operand)[0]);
+        case Command::putstatic:
+            return -SlotsOf(RefDescriptor(constants, instruction.Operand)[0]);
+        case Command::getfield:
+            return SlotsOf(RefDescriptor(constants, instruction.Operand)[0]) - 1;
+        case Command::putfield:
+            return -SlotsOf(RefDescriptor(constants, instruction.Operand)[0]) - 1;
+        case Command::invokestatic:
+            return InvokeStackEffect(RefDescriptor(constants, instruction.Operand));
+        case Command::invokevirtual:
+        case Command::invokespecial:
+            return InvokeStackEffect(RefDescriptor(constants, instruction.Operand)) - 1;
+        // The short and the wide local forms are picked when the code is written, they are never in Instructions
+        case Command::iload_0:
+        case Command::istore_0:
+        case Command::astore_0:
+        case Command::wide:
+            break;
+    }
+    throw std::runtime_error{ "Internal error: unknown stack effect of opcode "
+                              + std::to_string((int)instruction.Opcode) };
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "ByteWriter.h"
+#include "Commands.h"
+
+struct ConstantTable;
+
+using LabelT = uint32_t;
+
+struct Instruction
+{
+    Command Opcode{};
+    // Constant pool index, local variable index or immediate value, depending on the opcode
+    int32_t Operand = 0;
+    // Increment of iinc
+    int32_t SecondOperand = 0;
+    // Jump target, only for branch instructions
+    LabelT Target = 0;
+};
+
+// Collects the instructions of one method with symbolic jump targets.
+// Offsets are resolved only in Assemble, where jumps that do not fit into int16
+// are promoted to goto_w (conditional ones become an inverted condition jumping over goto_w).
+struct Assembler
+{
+    std::vector<Instruction> Instructions;
+    // Index of the instruction each label is bound to
+    std::vector<size_t> LabelPositions;
+
+    static constexpr auto UnboundLabel = static_cast<size_t>(-1);
+
+    [[nodiscard]] LabelT CreateLabel();
+
+    // Binds the label to the next emitted instruction
+    void Bind(LabelT label);
+
+    void Emit(Command command, int32_t operand = 0, int32_t secondOperand = 0);
+
+    void EmitJump(Command command, LabelT target);
+
+    // Drops instructions that no path from the method entry reaches.
+    // The split verifier rejects code after goto/return that has no stack map frame
+    void RemoveUnreachable();
+
+    // Drops the marked instructions. A label bound to a dropped instruction moves to the next kept one
+    void Remove(std::vector<bool> const& isRemoved);
+
+    // Returns the offset of every instruction, followed by the code length
+    std::vector<size_t> Assemble(ByteWriter& code) const;
+
+    // Code length in bytes once assembled
+    [[nodiscard]] size_t Length() const;
+
+    // Deepest operand stack over every path through the method.
+    // Invocations and field accesses are sized by their descriptors from constants
+    [[nodiscard]] uint16_t ComputeMaxStack(ConstantTable const& constants) const;
+
+private:
+    // Offsets of the instructions and the code length, isWide marks the jumps that need goto_w
+    std::vector<size_t> Layout(std::vector<bool>& isWide) const;
+};
+
+[[nodiscard]] bool IsJump(Command command);
+
+[[nodiscard]] Command InvertCondition(Command command);
+
+// Whether the instruction never passes control to the next one
+[[nodiscard]] bool EndsFlow(Command command);
+
+// Descriptor of the field or method the FieldRef/MethodRef constant points to
+[[nodiscard]] std::string_view RefDescriptor(ConstantTable const& constants, int32_t refId);
+
+[[nodiscard]] int StackEffect(Instruction const& instruction, ConstantTable const& constants);
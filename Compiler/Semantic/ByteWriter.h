@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "Commands.h"
+
+using Bytes = std::vector<unsigned char>;
+
+// Big-endian encoders of the class file numbers, they write into memory that is already allocated
+constexpr void PutU1(uint8_t* out, const uint8_t value) { out[0] = value; }
+
+constexpr void PutU2(uint8_t* out, const uint16_t value)
+{
+    out[0] = static_cast<uint8_t>(value >> 8);
+    out[1] = static_cast<uint8_t>(value);
+}
+
+constexpr void PutU4(uint8_t* out, const uint32_t value)
+{
+    PutU2(out, static_cast<uint16_t>(value >> 16));
+    PutU2(out + 2, static_cast<uint16_t>(value));
+}
+
+constexpr void PutI2(uint8_t* out, const int16_t value) { PutU2(out, static_cast<uint16_t>(value)); }
+
+constexpr void PutI4(uint8_t* out, const int32_t value) { PutU4(out, static_cast<uint32_t>(value)); }
+
+// Growable buffer that the code generator appends to, so every instruction is written exactly once.
+// Values that are not known yet (jump offsets, lengths) get a placeholder that is patched later.
+struct ByteWriter
+{
+    Bytes Data;
+
+    [[nodiscard]] size_t Position() const { return Data.size(); }
+
+    void Reserve(const size_t additionalSize) { Data.reserve(Data.size() + additionalSize); }
+
+    void Write(const uint8_t value) { Data.push_back(value); }
+
+    void Write(const Command command) { Data.push_back(static_cast<uint8_t>(command)); }
+
+    void Write(Bytes const& bytes) { Data.insert(Data.end(), bytes.begin(), bytes.end()); }
+
+    void Write(const std::string_view bytes) { Data.insert(Data.end(), bytes.begin(), bytes.end()); }
+
+    void WriteU2(const uint16_t value) { PutU2(Grow(sizeof value), value); }
+
+    void WriteU4(const uint32_t value) { PutU4(Grow(sizeof value), value); }
+
+    void WriteI2(const int16_t value) { PutI2(Grow(sizeof value), value); }
+
+    void WriteI4(const int32_t value) { PutI4(Grow(sizeof value), value); }
+
+    // Returns the position of the placeholder to pass into Patch
+    size_t WritePlaceholder(const size_t size)
+    {
+        const auto position = Position();
+        Data.resize(Data.size() + size);
+        return position;
+    }
+
+    void PatchI2(const size_t position, const int16_t value) { PutI2(Data.data() + position, value); }
+
+    void PatchU4(const size_t position, const uint32_t value) { PutU4(Data.data() + position, value); }
+
+private:
+    // Makes room for `size` more bytes and returns where they start
+    uint8_t* Grow(const size_t size)
+    {
+        Data.resize(Data.size() + size);
+        return Data.data() + Data.size() - size;
+    }
+};
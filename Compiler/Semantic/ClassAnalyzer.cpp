@@ -1,10 +1,15 @@
 // ReSharper disable CppCStyleCast
 #include "ClassAnalyzer.h"
 #include "Commands.h"
+#include "Assembler.h"
+#include "StackMap.h"
+#include "ConstantFolding.h"
 #include <iterator>
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <set>
+#include <cstring>
 using namespace std::string_literals;
 
 bool operator==(const Constant& lhs, const Constant& rhs)
@@ -98,100 +103,97 @@ Constant Constant::CreateMethodRef(IdT natId, IdT classId)
     return constant;
 }
 
+IdT ConstantTable::Add(Constant constant)
+{
+    Constants.push_back(std::move(constant));
+    return (IdT)Constants.size();
+}
+
 IdT ConstantTable::FindUtf8(std::string_view utf8)
 {
-    const auto constant = Constant::CreateUtf8(std::string{ utf8 });
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    if (const auto found = Utf8Ids.find(utf8); found != Utf8Ids.end())
+        return found->second;
+    const auto id = Add(Constant::CreateUtf8(std::string{ utf8 }));
+    Utf8Ids.emplace(Constants.back().Utf8, id);
+    return id;
 }
 
 IdT ConstantTable::FindString(std::string_view str)
 {
-    const auto constant = Constant::CreateString(FindUtf8(str));
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    const auto utf8Id = FindUtf8(str);
+    if (const auto found = StringIds.find(utf8Id); found != StringIds.end())
+        return found->second;
+    return StringIds[utf8Id] = Add(Constant::CreateString(utf8Id));
 }
 
 IdT ConstantTable::FindInt(IntT i)
 {
-    const auto constant = Constant::CreateInt(i);
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    if (const auto found = IntIds.find(i); found != IntIds.end())
+        return found->second;
+    return IntIds[i] = Add(Constant::CreateInt(i));
 }
 
 IdT ConstantTable::FindFloat(FloatT i)
 {
-    const auto constant = Constant::CreateFloat(i);
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    static_assert(sizeof(FloatT) == sizeof(uint64_t));
+    uint64_t bits;
+    std::memcpy(&bits, &i, sizeof bits);
+    if (const auto found = FloatIds.find(bits); found != FloatIds.end())
+        return found->second;
+    return FloatIds[bits] = Add(Constant::CreateFloat(i));
 }
 
 IdT ConstantTable::FindClass(std::string_view className)
 {
-    const auto constant = Constant::CreateClass(FindUtf8(className));
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    const auto classNameId = FindUtf8(className);
+    if (const auto found = ClassIds.find(classNameId); found != ClassIds.end())
+        return found->second;
+    return ClassIds[classNameId] = Add(Constant::CreateClass(classNameId));
 }
 
 IdT ConstantTable::FindNaT(std::string_view name, std::string_view type)
 {
-    const auto constant = Constant::CreateNaT(FindUtf8(name), FindUtf8(type));
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    const auto nameId = FindUtf8(name);
+    const auto typeId = FindUtf8(type);
+    const auto key = PackIds(nameId, typeId);
+    if (const auto found = NaTIds.find(key); found != NaTIds.end())
+        return found->second;
+    return NaTIds[key] = Add(Constant::CreateNaT(nameId, typeId));
 }
 
 IdT ConstantTable::FindFieldRef(std::string_view className, std::string_view name, std::string_view type)
 {
-    const auto constant = Constant::CreateFieldRef(FindNaT(name, type), FindClass(className));
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    const auto natId = FindNaT(name, type);
+    const auto classId = FindClass(className);
+    const auto key = PackIds(natId, classId);
+    if (const auto found = FieldRefIds.find(key); found != FieldRefIds.end())
+        return found->second;
+    return FieldRefIds[key] = Add(Constant::CreateFieldRef(natId, classId));
 }
 
 IdT ConstantTable::FindMethodRef(std::string_view className, std::string_view name, std::string_view type)
 {
-    const auto constant = Constant::CreateMethodRef(FindNaT(name, type), FindClass(className));
-    const auto foundIter = std::find(Constants.begin(), Constants.end(), constant);
-    if (foundIter == Constants.end())
-    {
-        Constants.push_back(constant);
-        return Constants.end() - Constants.begin();
-    }
-    return foundIter - Constants.begin() + 1;
+    const auto natId = FindNaT(name, type);
+    const auto classId = FindClass(className);
+    const auto key = PackIds(natId, classId);
+    if (const auto found = MethodRefIds.find(key); found != MethodRefIds.end())
+        return found->second;
+    return MethodRefIds[key] = Add(Constant::CreateMethodRef(natId, classId));
+}
+
+IdT ClassFile::FindStringLiteralField(const std::string_view literal)
+{
+    if (const auto found = StringLiteralFieldIds.find(literal); found != StringLiteralFieldIds.end())
+        return found->second;
+    StringLiterals.push_back(literal);
+    const auto name = StringLiteralFieldName(StringLiterals.size() - 1);
+    return StringLiteralFieldIds[literal] = Constants.FindFieldRef(ClassName, name, STD_STRING_TYPE.ToDescriptor());
+}
+
+std::string ClassFile::StringLiteralFieldName(const size_t index)
+{
+    // $ cannot appear in identifiers of the source language, so the name never clashes with a user field
+    return "$string" + std::to_string(index);
 }
 
 
@@ -210,7 +212,7 @@ ClassAnalyzer::ClassAnalyzer(ClassDeclNode* node, NamespaceDeclNode* namespace_,
         auto* constructor = new MethodDeclNode{
             VisibilityModifier::Public,
             nullptr,
-            "<init>",
+            Symbol::Intern("<init>"),
             MethodArguments::MakeEmpty(),
             StmtSeqNode::MakeEmpty()
         };
@@ -294,7 +296,10 @@ void ClassAnalyzer::AnalyzeVarDecl(VarDeclNode* varDecl, bool withInit)
         }
         varDecl->ScopingLevel = CurrentScopingLevel;
         CurrentMethod->Variables.push_back(varDecl);
-        varDecl->PositionInMethod = CurrentMethod->Variables.size() - 1;
+        // Variables of a scope are declared after every variable still in scope,
+        // so the slots above them are free once their scope ends
+        varDecl->PositionInMethod = CurrentMethod->NextFreeSlot++;
+        CurrentMethod->LocalsCount = std::max(CurrentMethod->LocalsCount, CurrentMethod->NextFreeSlot);
     }
 }
 
@@ -408,9 +413,9 @@ void ClassAnalyzer::AnalyzeMethod(MethodDeclNode* method)
             return;
         }
         AllMains.push_back(method);
-        CurrentMethod->_identifier = "main";
+        CurrentMethod->_identifier = Symbol::Intern("main");
         //   args  
-        CurrentMethod->Variables.push_back(new VarDeclNode(nullptr, "", nullptr));
+        CurrentMethod->Variables.push_back(new VarDeclNode(nullptr, {}, nullptr));
     }
 
     const auto canBeStatic = CurrentMethod->IsOperatorOverload || CurrentMethod->Identifier() == "main";
@@ -424,11 +429,14 @@ void ClassAnalyzer::AnalyzeMethod(MethodDeclNode* method)
     if (!CurrentMethod->IsStatic)
     {
         //   this
-        auto thisVar = new VarDeclNode(nullptr, "this", nullptr);
+        auto thisVar = new VarDeclNode(nullptr, Symbol::Intern("this"), nullptr);
         thisVar->AType = CurrentClass->ToDataType();
         CurrentMethod->Variables.push_back(thisVar);
     }
 
+    CurrentMethod->NextFreeSlot = (int)CurrentMethod->Variables.size();
+    CurrentMethod->LocalsCount = CurrentMethod->NextFreeSlot;
+
     const auto& allMethods = CurrentClass->Members->Methods;
     const auto sameMethodsCount = std::count_if(allMethods.begin(), allMethods.end(), [&](auto* otherMethod)
     {
@@ -440,7 +448,7 @@ void ClassAnalyzer::AnalyzeMethod(MethodDeclNode* method)
     if (sameMethodsCount > 1)
     {
         Errors.push_back("Method with name "
-                         + method->Identifier()
+                         + ToString(method->Identifier())
                          + " and with arguments of types: "
                          + ToString(ToTypes(method->ArgumentDtos))
                          + " has been already defined");
@@ -449,7 +457,7 @@ void ClassAnalyzer::AnalyzeMethod(MethodDeclNode* method)
     if (method->Body->GetSeq().empty() && method->AReturnType != DataType::VoidType)
     {
         Errors.push_back("There must be return statement in non-void method with name " +
-                         method->Identifier()
+                         ToString(method->Identifier())
                         );
         CurrentMethod = nullptr;
         return;
@@ -460,6 +468,7 @@ void ClassAnalyzer::AnalyzeMethod(MethodDeclNode* method)
     IncrementScopingLevel();
     for (auto* stmt : method->Body->GetSeq()) { AnalyzeStmt(stmt); }
     DecrementScopingLevel();
+    PropagateConstants(method);
     if (method->IsOperatorOverload)
     {
         const auto classDataType = CurrentClass->ToDataType();
@@ -491,9 +500,12 @@ void ClassAnalyzer::AnalyzeMethod(MethodDeclNode* method)
         && method->Body->GetSeq().back()->Type != StmtNode::TypeT::Return
         && method->AReturnType != DataType::VoidType)
     {
-        Errors.push_back("Last statement in method " + method->Identifier() + " must be return!");
+        Errors.push_back("Last statement in method " + ToString(method->Identifier()) + " must be return!");
     }
 
+    // Runs after the checks above, it may cut the trailing return that is never reached
+    PruneDeadCode(method);
+
     CurrentMethod = nullptr;
 }
 
@@ -574,7 +586,7 @@ void ClassAnalyzer::AnalyzeClass(ClassDeclNode* value)
 
     CalculateTypesForExpr(changed);
 
-    return changed;
+    return FoldConstants(changed);
 }
 
 void ClassAnalyzer::AnalyzeAccessExpr(AccessExpr* expr)
@@ -646,7 +658,7 @@ void ClassAnalyzer::AnalyzeSimpleMethodCall(AccessExpr* expr)
     if (CurrentMethod->IsStatic && !(*foundMethod)->IsStatic)
     {
         Errors.push_back("Cannot call non-static method with name \'" + std::string{ methodName } +
-                         "\' from static method with name \'" + CurrentMethod->Identifier() + "\'");
+                         "\' from static method with name \'" + ToString(CurrentMethod->Identifier()) + "\'");
         return;
     }
     AnalyzeMethodAccessibility(*foundMethod);
@@ -721,7 +733,7 @@ void ClassAnalyzer::AnalyzeMethodAccessibility(MethodDeclNode* method)
 
     if (sameClass || isPublic)
         return;
-    Errors.push_back("Cannot access " + ToString(method->Visibility) + " method " + method->Identifier() +
+    Errors.push_back("Cannot access " + ToString(method->Visibility) + " method " + ToString(method->Identifier()) +
                      " from class " + std::string{ CurrentClass->ClassName });
 }
 
@@ -913,6 +925,20 @@ void ClassAnalyzer::CalculateTypesForExpr(ExprNode* node)
                              });
             }
 
+            // A string and an int, char or bool are concatenated, the value is appended as text
+            if (candidates.empty() && node->Type == ExprNode::TypeT::BinPlus &&
+                ((IsStdString(leftType) && rightType.IsPrimitiveType()) ||
+                 (leftType.IsPrimitiveType() && IsStdString(rightType))))
+            {
+                node->AType = STD_STRING_TYPE;
+                return;
+            }
+            // Without an overload == and != compare references
+            if (candidates.empty() && IsEquality(node->Type) && leftType == rightType)
+            {
+                node->AType = boolType;
+                return;
+            }
             if (candidates.empty())
             {
                 Errors.push_back("There is no operator" + ToString(node->Type) + " overload to call with types " +
@@ -944,6 +970,11 @@ void ClassAnalyzer::CalculateTypesForExpr(ExprNode* node)
             node->AType = boolType;
             if (leftType == rightType)
                 return;
+            // Arrays and strings can be compared with null
+            const auto isNull = [](DataType const& type) { return type.AType == DataType::TypeT::Null; };
+            if (IsEquality(node->Type) && ((isNull(leftType) && rightType.IsReferenceType()) ||
+                                           (leftType.IsReferenceType() && isNull(rightType))))
+                return;
         }
         else if (leftType == rightType)
         {
@@ -1152,7 +1183,7 @@ DataType ClassAnalyzer::CalculateTypeForAccessExpr(AccessExpr* access)
         case AccessExpr::TypeT::Identifier:
         {
             auto isVariableFound = false;
-            const auto name = std::string{ access->Identifier };
+            const auto name = access->Identifier;
             if (CurrentMethod)
             {
                 if (auto* var = CurrentMethod->FindVariableByName(name, CurrentScopingLevel); var)
@@ -1184,7 +1215,7 @@ DataType ClassAnalyzer::CalculateTypeForAccessExpr(AccessExpr* access)
                 return type;
             }
 
-            Errors.push_back("Variable with name \"" + name + "\" is not found");
+            Errors.push_back("Variable with name \"" + ToString(name) + "\" is not found");
             break;
         }
         case AccessExpr::TypeT::Expr:
@@ -1246,7 +1277,7 @@ void ClassAnalyzer::ValidateTypename(DataType& dataType)
                                              });
         if (foundClass == allClassesInNamespace.end())
         {
-            Errors.push_back("No class " + dataType.ComplexType.back() + " in namespace " + std::string{
+            Errors.push_back("No class " + ToString(dataType.ComplexType.back()) + " in namespace " + std::string{
                                  namespace_->NamespaceName
                              });
             dataType.IsUnknown = true;
@@ -1254,7 +1285,7 @@ void ClassAnalyzer::ValidateTypename(DataType& dataType)
         }
         if (dataType.ComplexType.size() == 1)
         {
-            dataType.ComplexType.insert(dataType.ComplexType.begin(), std::string{ Namespace->NamespaceName });
+            dataType.ComplexType.insert(dataType.ComplexType.begin(), Namespace->NamespaceName);
         }
     }
 }
@@ -1315,212 +1346,178 @@ void ClassAnalyzer::FillTables(MethodDeclNode* method)
 
 void ClassAnalyzer::FillTables()
 {
+    File.ClassName = CurrentClass->ToDataType().ToTypename();
     for (auto* field : CurrentClass->Members->Fields) { FillTables(field); }
     for (auto* method : CurrentClass->Members->Methods) { FillTables(method); }
 }
 
-Bytes ToBytes(const ConstantTable& constants)
+void ToBytes(const ConstantTable& constants, ByteWriter& bytes)
 {
-    auto bytes = ToBytes((uint16_t)(constants.Constants.size() + 1));
-    for (auto const& constant : constants.Constants) { append(bytes, ToBytes(constant)); }
-    return bytes;
+    bytes.WriteU2((uint16_t)(constants.Constants.size() + 1));
+    for (auto const& constant : constants.Constants) { ToBytes(constant, bytes); }
 }
 
-Bytes ToBytes(JvmField field)
+size_t SizeInBytes(const ConstantTable& constants)
 {
-    Bytes bytes;
-    append(bytes, ToBytes(static_cast<uint16_t>(field.AccessFlags)));
-    append(bytes, ToBytes(field.NameId));
-    append(bytes, ToBytes(field.TypeId));
+    size_t size = sizeof(uint16_t);
+    for (auto const& constant : constants.Constants) { size += SizeInBytes(constant); }
+    return size;
+}
+
+void ToBytes(JvmField field, ByteWriter& bytes)
+{
+    bytes.WriteU2(static_cast<uint16_t>(field.AccessFlags));
+    bytes.WriteU2(field.NameId);
+    bytes.WriteU2(field.TypeId);
     constexpr auto attributesCount = (uint16_t)0;
-    append(bytes, ToBytes(attributesCount));
-    return bytes;
+    bytes.WriteU2(attributesCount);
 }
 
-Bytes ToBytes(ExprNode* expr, ClassFile& file);
+void ToBytes(ExprNode* expr, ClassFile& file, Assembler& code);
 
-Bytes ToBytes(AccessExpr* expr, ClassFile& file)
+void ToBytes(AccessExpr* expr, ClassFile& file, Assembler& code)
 {
     switch (expr->Type)
     {
         case AccessExpr::TypeT::Expr:
-            return ToBytes(expr->Child, file);
+            ToBytes(expr->Child, file, code);
+            return;
         case AccessExpr::TypeT::ArrayElementExpr:
         {
             const auto arrayType = expr->Previous->AType;
             const auto elementType = expr->AType;
-            Bytes bytes;
-            append(bytes, ToBytes(expr->Previous, file));
-            append(bytes, ToBytes(expr->Child, file));
+            ToBytes(expr->Previous, file, code);
+            ToBytes(expr->Child, file, code);
             if (elementType.IsPrimitiveType())
             {
                 if (elementType == DataType::IntType)
-                    append(bytes, (uint8_t)Command::iaload);
+                    code.Emit(Command::iaload);
                 else if (elementType == DataType::CharType)
-                    append(bytes, (uint8_t)Command::caload);
+                    code.Emit(Command::caload);
                 else if (elementType == DataType::BoolType)
-                    append(bytes, (uint8_t)Command::baload);
+                    code.Emit(Command::baload);
             }
             else
-                if (elementType.IsReferenceType()) { append(bytes, (uint8_t)Command::aaload); }
-            return bytes;
+                if (elementType.IsReferenceType()) { code.Emit(Command::aaload); }
+            return;
         }
         case AccessExpr::TypeT::ComplexArrayType:
             break;
         case AccessExpr::TypeT::Integer:
         {
-            Bytes bytes;
             const auto intVal = expr->Integer;
             if (intVal >= -32768 && intVal <= 32767)
             {
-                const auto intBytes = ToBytes((IntT)intVal);
-                bytes.push_back((uint8_t)Command::sipush);
-                bytes.push_back(intBytes[2]);
-                bytes.push_back(intBytes[3]);
+                code.Emit(Command::sipush, intVal);
             }
             else
             {
                 const auto constantId = file.Constants.FindInt(expr->Integer);
-                const auto constantIdBytes = ToBytes(constantId);
-                append(bytes, (uint8_t)Command::ldc_w);
-                append(bytes, constantIdBytes);
+                code.Emit(Command::ldc, constantId);
             }
-            return bytes;
+            return;
         }
         case AccessExpr::TypeT::Float:
             break;
         case AccessExpr::TypeT::String:
         {
-            Bytes bytes;
-
-            const auto stringClassId = file.Constants.FindClass(STD_STRING_TYPE.ToTypename());
-            append(bytes, (uint8_t)Command::new_);
-            append(bytes, ToBytes(stringClassId));
-            append(bytes, (uint8_t)Command::dup);
-
-            const auto stringLiteralId = file.Constants.FindString(expr->String);
-            append(bytes, (uint8_t)Command::ldc_w);
-            append(bytes, ToBytes(stringLiteralId));
-
-            const auto constructorId = file.Constants.FindMethodRef(STD_STRING_TYPE.ToTypename(),
-                                                                    STD_STRING_CONSTRUCTOR_INFO.Name,
-                                                                    STD_STRING_CONSTRUCTOR_INFO.Descriptor);
-            append(bytes, (uint8_t)Command::invokespecial);
-            append(bytes, ToBytes(constructorId));
-            return bytes;
+            // System/String is immutable, so every evaluation can share the object created in <clinit>
+            code.Emit(Command::getstatic, file.FindStringLiteralField(expr->String));
+            return;
         }
         case AccessExpr::TypeT::Char:
         {
-            Bytes bytes;
-            append(bytes, (uint8_t)Command::bipush);
-            append(bytes, expr->Char);
-            return bytes;
+            code.Emit(Command::bipush, expr->Char);
+            return;
         }
         case AccessExpr::TypeT::Bool:
         {
-            Bytes bytes;
             if (expr->Bool)
-                append(bytes, (uint8_t)Command::iconst_1);
+                code.Emit(Command::iconst_1);
             else
-                append(bytes, (uint8_t)Command::iconst_0);
-            return bytes;
+                code.Emit(Command::iconst_0);
+            return;
         }
         case AccessExpr::TypeT::Identifier:
         {
-            Bytes bytes;
             if (expr->ActualVar)
             {
                 auto* const var = expr->ActualVar;
                 if (var->AType.IsPrimitiveType())
                 {
-                    append(bytes, (uint8_t)Command::iload);
-                    append(bytes, (uint8_t)var->PositionInMethod);
+                    code.Emit(Command::iload, var->PositionInMethod);
                 }
                 if (var->AType.IsReferenceType())
                 {
-                    append(bytes, (uint8_t)Command::aload);
-                    append(bytes, (uint8_t)var->PositionInMethod);
+                    code.Emit(Command::aload, var->PositionInMethod);
                 }
-                return bytes;
+                return;
             }
             if (expr->ActualField)
             {
                 auto* const field = expr->ActualField;
-                Bytes objectBytes;
-                append(objectBytes, (uint8_t)Command::aload_0);
-                append(bytes, objectBytes);
-                append(bytes, (uint8_t)Command::getfield);
+                code.Emit(Command::aload_0);
 
                 const auto fieldRefId = file.Constants.FindFieldRef(field->Class->ToDataType().ToTypename(),
                                                                     field->VarDecl->Identifier,
                                                                     field->VarDecl->AType.ToDescriptor());
-                append(bytes, ToBytes(fieldRefId));
-                return bytes;
+                code.Emit(Command::getfield, fieldRefId);
+                return;
             }
             throw std::runtime_error{ "could not load " + std::string{ expr->Identifier } };
         }
         case AccessExpr::TypeT::SimpleMethodCall:
         {
-            Bytes bytes;
-
             //  this  
-            append(bytes, (uint8_t)Command::aload_0);
+            code.Emit(Command::aload_0);
 
             //    
-            for (auto* arg : expr->Arguments->GetSeq()) { append(bytes, ToBytes(arg, file)); }
+            for (auto* arg : expr->Arguments->GetSeq()) { ToBytes(arg, file, code); }
 
             const auto* method = expr->ActualMethodCall;
             const auto methodRefConstant = file.Constants.FindMethodRef(method->Class->ToDataType().ToTypename(),
                                                                         method->Identifier(), method->ToDescriptor());
-            append(bytes, (uint8_t)Command::invokevirtual);
-            append(bytes, ToBytes(methodRefConstant));
-            return bytes;
+            code.Emit(Command::invokevirtual, methodRefConstant);
+            return;
         }
         case AccessExpr::TypeT::Dot:
         {
             if (expr->ActualField)
             {
-                Bytes bytes;
                 auto* const field = expr->ActualField;
-                Bytes objectBytes = ToBytes(expr->Previous, file);
-                append(bytes, objectBytes);
-                append(bytes, (uint8_t)Command::getfield);
+                ToBytes(expr->Previous, file, code);
 
                 const auto fieldRefId = file.Constants.FindFieldRef(field->Class->ToDataType().ToTypename(),
                                                                     field->VarDecl->Identifier,
                                                                     field->VarDecl->AType.ToDescriptor());
-                append(bytes, ToBytes(fieldRefId));
-                return bytes;
+                code.Emit(Command::getfield, fieldRefId);
+                return;
             }
             break;
         }
         case AccessExpr::TypeT::DotMethodCall:
         {
-            Bytes bytes;
             //     
-            append(bytes, ToBytes(expr->Previous, file));
+            ToBytes(expr->Previous, file, code);
 
             //    
-            for (auto* arg : expr->Arguments->GetSeq()) { append(bytes, ToBytes(arg, file)); }
+            for (auto* arg : expr->Arguments->GetSeq()) { ToBytes(arg, file, code); }
 
             const auto* method = expr->ActualMethodCall;
             const auto methodRefConstant = file.Constants.FindMethodRef(method->Class->ToDataType().ToTypename(),
                                                                         method->Identifier(), method->ToDescriptor());
-            append(bytes, (uint8_t)Command::invokevirtual);
-            append(bytes, ToBytes(methodRefConstant));
-            return bytes;
+            code.Emit(Command::invokevirtual, methodRefConstant);
+            return;
         }
         case AccessExpr::TypeT::ArrayLength:
         {
-            Bytes bytes;
             //     
-            append(bytes, ToBytes(expr->Previous, file));
-            append(bytes, (uint8_t)Command::arraylength);
-            return bytes;
+            ToBytes(expr->Previous, file, code);
+            code.Emit(Command::arraylength);
+            return;
         }
         default: ;
     }
-    return {};
 }
 
 enum class ArrayType : uint8_t
@@ -1535,42 +1532,217 @@ enum class ArrayType : uint8_t
     Long = 11
 };
 
-Bytes ToBytes(ExprNode* expr, ClassFile& file)
+// + of System/String operands, or of a string and a primitive value
+bool IsStringConcatenation(ExprNode* expr)
 {
-    if (expr->Type == ExprNode::TypeT::Null)
+    return expr->Type == ExprNode::TypeT::BinPlus && IsStdString(expr->AType)
+           && (!expr->OverloadedOperation || IsStdString(expr->OverloadedOperation->Class->ToDataType()));
+}
+
+void CollectConcatenated(ExprNode* expr, std::vector<ExprNode*>& operands)
+{
+    if (IsStringConcatenation(expr))
     {
-        Bytes bytes;
-        append(bytes, (uint8_t)Command::aconst_null);
-        return bytes;
+        CollectConcatenated(expr->Left, operands);
+        CollectConcatenated(expr->Right, operands);
     }
-    if (expr->OverloadedOperation)
+    else if (expr->Type == ExprNode::TypeT::AccessExpr && expr->Access->Type == AccessExpr::TypeT::Expr
+             && IsStringConcatenation(expr->Access->Child))
     {
-        Bytes bytes;
+        // Concatenation is associative, a + (b + c) is appended like a + b + c
+        CollectConcatenated(expr->Access->Child, operands);
+    }
+    else { operands.push_back(expr); }
+}
 
-        if (IsBinary(expr->Type))
+// A whole chain a + b + c + ... goes through one java/lang/StringBuilder and allocates a single System/String
+// for the result, instead of a wrapper and a java/lang/String per operator
+void ConcatenationToBytes(ExprNode* expr, ClassFile& file, Assembler& code)
+{
+    constexpr std::string_view builderClass = "java/lang/StringBuilder";
+    const auto stringClass = STD_STRING_TYPE.ToTypename();
+
+    std::vector<ExprNode*> operands;
+    CollectConcatenated(expr, operands);
+
+    code.Emit(Command::new_, file.Constants.FindClass(stringClass));
+    code.Emit(Command::dup);
+    code.Emit(Command::new_, file.Constants.FindClass(builderClass));
+    code.Emit(Command::dup);
+    code.Emit(Command::invokespecial, file.Constants.FindMethodRef(builderClass, "<init>", "()V"));
+
+    for (auto* operand : operands)
+    {
+        // A literal is appended as its java/lang/String constant, its System/String object is not needed
+        if (operand->Type == ExprNode::TypeT::AccessExpr && operand->Access->Type == AccessExpr::TypeT::String)
         {
-            const auto leftBytes = ToBytes(expr->Left, file);
-            const auto rightBytes = ToBytes(expr->Right, file);
-            append(bytes, leftBytes);
-            append(bytes, rightBytes);
+            const auto stringId = file.Constants.FindString(operand->Access->String);
+            code.Emit(Command::ldc, stringId);
+            code.Emit(Command::invokevirtual, file.Constants.FindMethodRef(builderClass, "append",
+                                                                           "(Ljava/lang/String;)Ljava/lang/StringBuilder;"));
+            continue;
         }
-        if (IsUnary(expr->Type))
+
+        ToBytes(operand, file, code);
+
+        // Primitives are appended as they are, without a wrapper object
+        std::string_view descriptor;
+        switch (operand->AType.IsPrimitiveType() ? operand->AType.AType : DataType::TypeT::String)
         {
-            const auto childBytes = ToBytes(expr->Child, file);
-            append(bytes, childBytes);
+            case DataType::TypeT::Int:
+                descriptor = "(I)Ljava/lang/StringBuilder;";
+                break;
+            case DataType::TypeT::Char:
+                descriptor = "(C)Ljava/lang/StringBuilder;";
+                break;
+            case DataType::TypeT::Bool:
+                descriptor = "(Z)Ljava/lang/StringBuilder;";
+                break;
+            default:
+                code.Emit(Command::invokevirtual, file.Constants.FindMethodRef(stringClass,
+                                                                               STD_STRING_TO_STRING_INFO.Name,
+                                                                               STD_STRING_TO_STRING_INFO.Descriptor));
+                descriptor = "(Ljava/lang/String;)Ljava/lang/StringBuilder;";
+                break;
         }
+        code.Emit(Command::invokevirtual, file.Constants.FindMethodRef(builderClass, "append", descriptor));
+    }
+
+    code.Emit(Command::invokevirtual,
+              file.Constants.FindMethodRef(builderClass, "toString", "()Ljava/lang/String;"));
+    code.Emit(Command::invokespecial, file.Constants.FindMethodRef(stringClass, STD_STRING_CONSTRUCTOR_INFO.Name,
+                                                                   STD_STRING_CONSTRUCTOR_INFO.Descriptor));
+}
+
+bool IsZeroLiteral(ExprNode* expr)
+{
+    return expr->Type == ExprNode::TypeT::AccessExpr && expr->Access->Type == AccessExpr::TypeT::Integer
+           && expr->Access->Integer == 0;
+}
+
+// Jump taken when a comparison holds: against another int, against zero, between references or against null
+Command ComparisonJump(const ExprNode::TypeT type, const bool isReference, const bool isZero, const bool isNull)
+{
+    if (isNull)
+        return type == ExprNode::TypeT::Equal ? Command::ifnull : Command::ifnonnull;
+    if (isReference)
+        return type == ExprNode::TypeT::Equal ? Command::if_acmpeq : Command::if_acmpne;
+
+    switch (type) // NOLINT(clang-diagnostic-switch-enum)
+    {
+        case ExprNode::TypeT::Less:
+            return isZero ? Command::iflt : Command::if_icmplt;
+        case ExprNode::TypeT::Greater:
+            return isZero ? Command::ifgt : Command::if_icmpgt;
+        case ExprNode::TypeT::Equal:
+            return isZero ? Command::ifeq : Command::if_icmpeq;
+        case ExprNode::TypeT::NotEqual:
+            return isZero ? Command::ifne : Command::if_icmpne;
+        case ExprNode::TypeT::GreaterOrEqual:
+            return isZero ? Command::ifge : Command::if_icmpge;
+        case ExprNode::TypeT::LessOrEqual:
+            return isZero ? Command::ifle : Command::if_icmple;
+        default:
+            throw std::runtime_error{ "Internal error: not a comparison" };
+    }
+}
+
+// Jumps to target when the condition evaluates to jumpIfTrue and falls through otherwise.
+// Comparisons and logical operators branch directly instead of pushing 0/1 and testing it with ifeq
+void ConditionToBytes(ExprNode* condition, const bool jumpIfTrue, const LabelT target, ClassFile& file,
+                      Assembler& code)
+{
+    // Parentheses
+    if (condition->Type == ExprNode::TypeT::AccessExpr && condition->Access->Type == AccessExpr::TypeT::Expr)
+    {
+        ConditionToBytes(condition->Access->Child, jumpIfTrue, target, file, code);
+        return;
+    }
+
+    if (!condition->OverloadedOperation)
+    {
+        if (condition->Type == ExprNode::TypeT::Not)
+        {
+            ConditionToBytes(condition->Child, !jumpIfTrue, target, file, code);
+            return;
+        }
+
+        if (condition->Type == ExprNode::TypeT::And || condition->Type == ExprNode::TypeT::Or)
+        {
+            // The left operand decides alone when && is false or || is true
+            const auto leftDecides = (condition->Type == ExprNode::TypeT::Or) == jumpIfTrue;
+            if (leftDecides)
+            {
+                ConditionToBytes(condition->Left, jumpIfTrue, target, file, code);
+                ConditionToBytes(condition->Right, jumpIfTrue, target, file, code);
+            }
+            else
+            {
+                const auto skipLabel = code.CreateLabel();
+                ConditionToBytes(condition->Left, !jumpIfTrue, skipLabel, file, code);
+                ConditionToBytes(condition->Right, jumpIfTrue, target, file, code);
+                code.Bind(skipLabel);
+            }
+            return;
+        }
+
+        if (IsComparison(condition->Type))
+        {
+            auto* left = condition->Left;
+            auto* right = condition->Right;
+            if (left->Type == ExprNode::TypeT::Null)
+                std::swap(left, right);
+
+            const auto isNull = right->Type == ExprNode::TypeT::Null;
+            const auto isReference = left->AType.IsReferenceType() || left->Type == ExprNode::TypeT::Null;
+            const auto isZero = !isReference && IsZeroLiteral(right);
+
+            ToBytes(left, file, code);
+            if (!isNull && !isZero)
+                ToBytes(right, file, code);
+
+            const auto command = ComparisonJump(condition->Type, isReference, isZero, isNull);
+            code.EmitJump(jumpIfTrue ? command : InvertCondition(command), target);
+            return;
+        }
+    }
+
+    ToBytes(condition, file, code);
+    code.EmitJump(jumpIfTrue ? Command::ifne : Command::ifeq, target);
+}
+
+void ToBytes(ExprNode* expr, ClassFile& file, Assembler& code)
+{
+    if (!expr)
+        return;
+    if (expr->Type == ExprNode::TypeT::Null)
+    {
+        code.Emit(Command::aconst_null);
+        return;
+    }
+    if (IsStringConcatenation(expr))
+    {
+        ConcatenationToBytes(expr, file, code);
+        return;
+    }
+    if (expr->OverloadedOperation)
+    {
+        if (IsBinary(expr->Type))
+        {
+            ToBytes(expr->Left, file, code);
+            ToBytes(expr->Right, file, code);
+        }
+        if (IsUnary(expr->Type)) { ToBytes(expr->Child, file, code); }
         const auto operatorRef = file.Constants.FindMethodRef(expr->OverloadedOperation->Class->ToDataType().
                                                                     ToTypename(),
                                                               expr->OverloadedOperation->Identifier(),
                                                               expr->OverloadedOperation->ToDescriptor());
-        append(bytes, (uint8_t)Command::invokestatic);
-        append(bytes, ToBytes(operatorRef));
-        return bytes;
+        code.Emit(Command::invokestatic, operatorRef);
+        return;
     }
 
     if (expr->Type == ExprNode::TypeT::Increment || expr->Type == ExprNode::TypeT::Decrement)
     {
-        Bytes bytes;
         auto* access = expr->Child->Access;
         if (!access)
             throw std::runtime_error{ "Internal error: increment not for a variable or field" };
@@ -1580,17 +1752,12 @@ Bytes ToBytes(ExprNode* expr, ClassFile& file)
 
         if (variable)
         {
-            auto varIndex = (uint8_t)variable->PositionInMethod;
-            //   iinc
-            append(bytes, (uint8_t)Command::iinc);
-            //  varIndex
-            append(bytes, varIndex);
             //   1 / -1
             int8_t incVal = expr->Type == ExprNode::TypeT::Increment ? 1 : -1;
-            append(bytes, incVal);
+            //   iinc   
+            code.Emit(Command::iinc, variable->PositionInMethod, incVal);
             //     iload
-            append(bytes, (uint8_t)Command::iload);
-            append(bytes, (uint8_t)variable->PositionInMethod);
+            code.Emit(Command::iload, variable->PositionInMethod);
         }
         if (field)
         {
@@ -1600,164 +1767,62 @@ Bytes ToBytes(ExprNode* expr, ClassFile& file)
             //   dup
             //  putfield
         }
-        return bytes;
+        return;
     }
 
-    if (IsComparison(expr->Type) || expr->Type == ExprNode::TypeT::Not)
+    if (IsComparison(expr->Type) || IsLogical(expr->Type))
     {
-        Bytes bytes;
-        if (expr->Type == ExprNode::TypeT::Not)
-        {
-            const auto childBytes = ToBytes(expr->Child, file);
-            append(bytes, childBytes);
-        }
-        else
-        {
-            const auto leftBytes = ToBytes(expr->Left, file);
-            const auto rightBytes = ToBytes(expr->Right, file);
-
-            append(bytes, leftBytes);
-            append(bytes, rightBytes);
-        }
-
-        Command command{};
-
-        // ReSharper disable once CppIncompleteSwitchStatement 
-        // ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-        switch (expr->Type)
-        {
-                // NOLINT(clang-diagnostic-switch)
-            case ExprNode::TypeT::Less:
-                command = Command::if_icmpge;
-                break;
-            case ExprNode::TypeT::Greater:
-                command = Command::if_icmple;
-                break;
-            case ExprNode::TypeT::Equal:
-                command = Command::if_icmpne;
-                break;
-            case ExprNode::TypeT::NotEqual:
-                command = Command::if_icmpeq;
-                break;
-            case ExprNode::TypeT::GreaterOrEqual:
-                command = Command::if_icmplt;
-                break;
-            case ExprNode::TypeT::LessOrEqual:
-                command = Command::if_icmpgt;
-                break;
-            case ExprNode::TypeT::Not:
-                command = Command::ifne;
-                break;
-        }
+        const auto falseLabel = code.CreateLabel();
+        const auto endLabel = code.CreateLabel();
 
-        append(bytes, (uint8_t)command);
-        const auto falseCommandOffset = ToBytes((int16_t)7);
-        append(bytes, falseCommandOffset);
+        ConditionToBytes(expr, false, falseLabel, file, code);
         //  true
-        append(bytes, (uint8_t)Command::iconst_1);
+        code.Emit(Command::iconst_1);
         //    if/else
-        append(bytes, (uint8_t)Command::goto_);
-        const auto trueOffset = ToBytes((int16_t)4);
-        append(bytes, trueOffset);
+        code.EmitJump(Command::goto_, endLabel);
         //  false
-        append(bytes, (uint8_t)Command::iconst_0);
+        code.Bind(falseLabel);
+        code.Emit(Command::iconst_0);
         // ,    .
         //    ,       goto
-        append(bytes, (uint8_t)Command::nop);
-
-        return bytes;
+        code.Bind(endLabel);
+        code.Emit(Command::nop);
+        return;
     }
 
     if (expr->Type == ExprNode::TypeT::Assign)
     {
         if (expr->Left->Access && expr->Left->Access->ActualVar)
         {
-            Bytes bytes;
-            const auto rightBytes = ToBytes(expr->Right, file);
-            append(bytes, rightBytes);
+            ToBytes(expr->Right, file, code);
             auto* var = expr->Left->Access->ActualVar;
-            const auto variableNumberBytes = (uint8_t)(var->PositionInMethod);
-            if (var->AType.IsReferenceType()) { append(bytes, (uint8_t)Command::astore); }
+            if (var->AType.IsReferenceType()) { code.Emit(Command::astore, var->PositionInMethod); }
             else
-                if (var->AType.IsPrimitiveType()) { append(bytes, (uint8_t)Command::istore); }
-
-            append(bytes, variableNumberBytes);
-            return bytes;
+                if (var->AType.IsPrimitiveType()) { code.Emit(Command::istore, var->PositionInMethod); }
+            return;
         }
         throw std::runtime_error{ "only variable can be assigned" };
     }
 
-    if (IsLogical(expr->Type) && IsBinary(expr->Type))
-    {
-        Bytes bytes;
-        const auto leftBytes = ToBytes(expr->Left, file);
-        const auto rightBytes = ToBytes(expr->Right, file);
-
-        append(bytes, leftBytes);
-
-        Command command{};
-        Bytes firstJumpBytes;
-
-        constexpr auto ifeqLength = 3;
-        constexpr auto gotoLength = 3;
-        constexpr auto iconstLength = 1;
-
-        const auto trueValueOffset = rightBytes.size() + ifeqLength + iconstLength;
-        const auto falseValueOffset = rightBytes.size() + ifeqLength + iconstLength * 2 + gotoLength;
-
-        if (expr->Type == ExprNode::TypeT::And)
-        {
-            command = Command::ifeq;
-            firstJumpBytes = ToBytes((uint16_t)falseValueOffset);
-        }
-        else if (expr->Type == ExprNode::TypeT::Or)
-        {
-            command = Command::ifne;
-            firstJumpBytes = ToBytes((uint16_t)trueValueOffset);
-        }
-
-        append(bytes, (uint8_t)command);
-        append(bytes, firstJumpBytes);
-
-        append(bytes, rightBytes);
-
-        append(bytes, (uint8_t)Command::ifeq);
-        append(bytes, ToBytes((uint16_t)(ifeqLength + gotoLength + iconstLength)));
-
-        append(bytes, (uint8_t)Command::iconst_1);
-
-        append(bytes, (uint8_t)Command::goto_);
-        append(bytes, ToBytes((uint16_t)(gotoLength + iconstLength)));
-
-        append(bytes, (uint8_t)Command::iconst_0);
-
-        append(bytes, (uint8_t)Command::nop);
-
-        return bytes;
-    }
-
     if (IsBinary(expr->Type))
     {
-        Bytes bytes;
-        const auto leftBytes = ToBytes(expr->Left, file);
-        const auto rightBytes = ToBytes(expr->Right, file);
-        append(bytes, leftBytes);
-        append(bytes, rightBytes);
+        ToBytes(expr->Left, file, code);
+        ToBytes(expr->Right, file, code);
         if (expr->AType.IsPrimitiveType())
         {
             switch (expr->Type) // NOLINT(clang-diagnostic-switch-enum)
             {
                 case ExprNode::TypeT::BinPlus:
-                    append(bytes, (uint8_t)Command::iadd);
+                    code.Emit(Command::iadd);
                     break;
                 case ExprNode::TypeT::BinMinus:
-                    append(bytes, (uint8_t)Command::isub);
+                    code.Emit(Command::isub);
                     break;
                 case ExprNode::TypeT::Multiply:
-                    append(bytes, (uint8_t)Command::imul);
+                    code.Emit(Command::imul);
                     break;
                 case ExprNode::TypeT::Divide:
-                    append(bytes, (uint8_t)Command::idiv);
+                    code.Emit(Command::idiv);
                     break;
 
                 default:
@@ -1765,19 +1830,17 @@ Bytes ToBytes(ExprNode* expr, ClassFile& file)
             }
         }
         else { throw std::runtime_error{ "Only ints are supported" }; }
-        return bytes;
+        return;
     }
 
     if (IsUnary(expr->Type))
     {
-        Bytes bytes;
-        const auto childBytes = ToBytes(expr->Child, file);
-        append(bytes, childBytes);
+        ToBytes(expr->Child, file, code);
         switch (expr->Type)
         {
             case ExprNode::TypeT::UnaryMinus:
             {
-                append(bytes, (uint8_t)Command::ineg);
+                code.Emit(Command::ineg);
                 break;
             }
             case ExprNode::TypeT::UnaryPlus:
@@ -1785,11 +1848,14 @@ Bytes ToBytes(ExprNode* expr, ClassFile& file)
             default:
                 throw std::runtime_error{ "Not supported operation " + ToString(expr->Type) };
         }
-
-        return bytes;
+        return;
     }
 
-    if (expr->Type == ExprNode::TypeT::AccessExpr) { return ToBytes(expr->Access, file); }
+    if (expr->Type == ExprNode::TypeT::AccessExpr)
+    {
+        ToBytes(expr->Access, file, code);
+        return;
+    }
 
     if (expr->Type == ExprNode::TypeT::SimpleNew)
     {
@@ -1798,16 +1864,12 @@ Bytes ToBytes(ExprNode* expr, ClassFile& file)
             throw std::runtime_error{ "Cannot create object of type " + ToString(type) };
         const auto classIdConstant = file.Constants.FindClass(type.ToTypename());
 
-        Bytes bytes;
-        append(bytes, (uint8_t)Command::new_);
-        append(bytes, ToBytes(classIdConstant));
-        append(bytes, (uint8_t)Command::dup);
+        code.Emit(Command::new_, classIdConstant);
+        code.Emit(Command::dup);
 
         const auto constructorRef = file.Constants.FindMethodRef(type.ToTypename(), "<init>", "()V");
-        append(bytes, (uint8_t)Command::invokespecial);
-        append(bytes, ToBytes(constructorRef));
-
-        return bytes;
+        code.Emit(Command::invokespecial, constructorRef);
+        return;
     }
 
     if (expr->Type == ExprNode::TypeT::ArrayNew)
@@ -1821,25 +1883,21 @@ Bytes ToBytes(ExprNode* expr, ClassFile& file)
             throw std::runtime_error{ "Cannot create multidimensional array" };
         if (elementType.IsPrimitiveType())
         {
-            Bytes bytes;
-            append(bytes, ToBytes(expr->Child, file));
-            append(bytes, (uint8_t)Command::newarray);
+            ToBytes(expr->Child, file, code);
             if (type.AType == DataType::TypeT::Int)
-                append(bytes, (uint8_t)ArrayType::Int);
+                code.Emit(Command::newarray, (uint8_t)ArrayType::Int);
             else if (type.AType == DataType::TypeT::Char)
-                append(bytes, (uint8_t)ArrayType::Char);
+                code.Emit(Command::newarray, (uint8_t)ArrayType::Char);
             else if (type.AType == DataType::TypeT::Bool)
-                append(bytes, (uint8_t)ArrayType::Boolean);
-            return bytes;
+                code.Emit(Command::newarray, (uint8_t)ArrayType::Boolean);
+            return;
         }
         if (elementType.IsReferenceType())
         {
-            Bytes bytes;
-            append(bytes, ToBytes(expr->Child, file));
-            append(bytes, (uint8_t)Command::anewarray);
+            ToBytes(expr->Child, file, code);
             const auto classId = file.Constants.FindClass(elementType.ToTypename());
-            append(bytes, ToBytes(classId));
-            return bytes;
+            code.Emit(Command::anewarray, classId);
+            return;
         }
     }
 
@@ -1848,447 +1906,475 @@ Bytes ToBytes(ExprNode* expr, ClassFile& file)
         const auto arrayType = expr->ArrayExpr->AType;
         auto elementType = arrayType;
         elementType.ArrayArity--;
-        Bytes bytes;
-        append(bytes, ToBytes(expr->ArrayExpr, file));
-        append(bytes, ToBytes(expr->IndexExpr, file));
-        append(bytes, ToBytes(expr->AssignExpr, file));
+        ToBytes(expr->ArrayExpr, file, code);
+        ToBytes(expr->IndexExpr, file, code);
+        ToBytes(expr->AssignExpr, file, code);
         if (elementType.IsPrimitiveType())
         {
             if (elementType == DataType::IntType)
-                append(bytes, (uint8_t)Command::iastore);
+                code.Emit(Command::iastore);
             else if (elementType == DataType::CharType)
-                append(bytes, (uint8_t)Command::castore);
+                code.Emit(Command::castore);
             else if (elementType == DataType::BoolType)
-                append(bytes, (uint8_t)Command::bastore);
+                code.Emit(Command::bastore);
         }
-        if (elementType.IsReferenceType()) { append(bytes, (uint8_t)Command::aastore); }
-        return bytes;
+        if (elementType.IsReferenceType()) { code.Emit(Command::aastore); }
+        return;
     }
 
     if (expr->Type == ExprNode::TypeT::AssignOnField)
     {
-        Bytes bytes;
-
-        Bytes objectBytes;
-
-        if (expr->ObjectExpr) { objectBytes = ToBytes(expr->ObjectExpr, file); }
-        else { append(objectBytes, (uint8_t)Command::aload_0); }
+        if (expr->ObjectExpr) { ToBytes(expr->ObjectExpr, file, code); }
+        else { code.Emit(Command::aload_0); }
 
         auto* const field = expr->Field;
-        append(bytes, objectBytes);
-        append(bytes, ToBytes(expr->AssignExpr, file));
+        ToBytes(expr->AssignExpr, file, code);
 
-        append(bytes, (uint8_t)Command::putfield);
         const auto fieldRefId = file.Constants.FindFieldRef(field->Class->ToDataType().ToTypename(),
                                                             field->VarDecl->Identifier,
                                                             field->VarDecl->AType.ToDescriptor());
-        append(bytes, ToBytes(fieldRefId));
-        return bytes;
+        code.Emit(Command::putfield, fieldRefId);
     }
-
-    return {};
 }
 
-Bytes ToBytes(VarDeclNode* node, ClassFile& file)
+void ToBytes(VarDeclNode* node, ClassFile& file, Assembler& code)
 {
-    Bytes bytes;
-
     //  
-    if (node->InitExpr) { append(bytes, ToBytes(node->InitExpr, file)); }
+    if (node->InitExpr) { ToBytes(node->InitExpr, file, code); }
     else
     {
-        if (node->AType.IsPrimitiveType()) { append(bytes, (uint8_t)Command::iconst_0); }
-        else if (node->AType.IsReferenceType()) { append(bytes, (uint8_t)Command::aconst_null); }
+        if (node->AType.IsPrimitiveType()) { code.Emit(Command::iconst_0); }
+        else if (node->AType.IsReferenceType()) { code.Emit(Command::aconst_null); }
         else { throw std::runtime_error("unsupported type of variable " + ToString(node->AType)); }
     }
 
-    if (node->AType.IsPrimitiveType()) { append(bytes, (uint8_t)Command::istore); }
+    if (node->AType.IsPrimitiveType()) { code.Emit(Command::istore, node->PositionInMethod); }
     else
-        if (node->AType.IsReferenceType()) { append(bytes, (uint8_t)Command::astore); }
+        if (node->AType.IsReferenceType()) { code.Emit(Command::astore, node->PositionInMethod); }
+}
 
-    append(bytes, (uint8_t)node->PositionInMethod);
+void ToBytes(StmtNode* stmt, ClassFile& file, Assembler& code);
 
-    return bytes;
-}
+// Evaluates an expression for its side effects only. The value is popped, otherwise
+// a loop would grow the operand stack on every iteration
+void ExprStmtToBytes(ExprNode* expr, ClassFile& file, Assembler& code)
+{
+    if (!expr)
+        return;
+    ToBytes(expr, file, code);
 
-Bytes ToBytes(StmtNode* stmt, ClassFile& file);
+    const auto isAssignment = expr->Type == ExprNode::TypeT::Assign
+                              || expr->Type == ExprNode::TypeT::AssignOnArrayElement
+                              || expr->Type == ExprNode::TypeT::AssignOnField;
+    // Increment of a field is not generated yet, so it leaves nothing on the stack
+    const auto isFieldIncrement = !expr->OverloadedOperation
+                                  && (expr->Type == ExprNode::TypeT::Increment
+                                      || expr->Type == ExprNode::TypeT::Decrement)
+                                  && !expr->Child->Access->ActualVar;
+    // The type of a call may have been taken before the callee's class was analyzed, so ask the callee
+    const auto isCall = expr->Type == ExprNode::TypeT::AccessExpr && expr->Access->ActualMethodCall;
+    const auto type = isCall ? expr->Access->ActualMethodCall->AReturnType : expr->AType;
+    if (!isAssignment && !isFieldIncrement && type != DataType::VoidType)
+        code.Emit(Command::pop);
+}
 
-Bytes ToBytes(StmtSeqNode* block, ClassFile& file)
+void ToBytes(StmtSeqNode* block, ClassFile& file, Assembler& code)
 {
-    Bytes bytes;
-    for (auto* stmt : block->GetSeq()) { append(bytes, ToBytes(stmt, file)); }
-    return bytes;
+    for (auto* stmt : block->GetSeq()) { ToBytes(stmt, file, code); }
 }
 
-Bytes ToBytes(IfNode* stmt, ClassFile& file)
+void ToBytes(IfNode* stmt, ClassFile& file, Assembler& code)
 {
     const auto hasElse = stmt->ElseBranch != nullptr;
-    const auto conditionBytes = ToBytes(stmt->Condition, file);
-    auto trueBranchBytes = ToBytes(stmt->ThenBranch, file);
-    const auto elseBytes = ToBytes(stmt->ElseBranch, file);
+    const auto elseLabel = code.CreateLabel();
+    const auto endLabel = code.CreateLabel();
 
-    Bytes bytes;
-    append(bytes, conditionBytes);
+    ConditionToBytes(stmt->Condition, false, hasElse ? elseLabel : endLabel, file, code);
+    ToBytes(stmt->ThenBranch, file, code);
 
     if (hasElse)
     {
-        const auto trueBranchOffset = ToBytes((int16_t)(elseBytes.size() + 3));
-        append(trueBranchBytes, (uint8_t)Command::goto_);
-        append(trueBranchBytes, trueBranchOffset);
+        code.EmitJump(Command::goto_, endLabel);
+        code.Bind(elseLabel);
+        ToBytes(stmt->ElseBranch, file, code);
     }
 
-    append(bytes, (uint8_t)Command::ifeq);
-    append(bytes, ToBytes((int16_t)(trueBranchBytes.size() + 3)));
-    append(bytes, trueBranchBytes);
-    append(bytes, elseBytes);
-    append(bytes, (uint8_t)Command::nop);
-
-    return bytes;
+    code.Bind(endLabel);
+    code.Emit(Command::nop);
 }
 
-Bytes ReturnToBytes(ExprNode* returnExpr, ClassFile& file)
+void ReturnToBytes(ExprNode* returnExpr, ClassFile& file, Assembler& code)
 {
-    Bytes bytes;
-    if (returnExpr == nullptr) { append(bytes, (uint8_t)Command::return_); }
+    if (returnExpr == nullptr) { code.Emit(Command::return_); }
     else if (returnExpr->AType == DataType::IntType || returnExpr->AType == DataType::BoolType)
     {
-        append(bytes, ToBytes(returnExpr, file));
-        append(bytes, (uint8_t)Command::ireturn);
+        ToBytes(returnExpr, file, code);
+        code.Emit(Command::ireturn);
     }
     else if (returnExpr->AType.IsReferenceType())
     {
-        append(bytes, ToBytes(returnExpr, file));
-        append(bytes, (uint8_t)Command::areturn);
+        ToBytes(returnExpr, file, code);
+        code.Emit(Command::areturn);
     }
-
-    return bytes;
 }
 
-Bytes ToBytes(WhileNode* while_, ClassFile& file)
+// Loops are rotated: the condition is tested at the bottom and jumps back to the body,
+// so an iteration takes one branch. A while or for loop enters through a jump to the test
+void LoopToBytes(ExprNode* condition, LabelT bodyLabel, ClassFile& file, Assembler& code)
 {
-    Bytes bytes;
-
-    const auto conditionBytes = ToBytes(while_->Condition, file);
-    const auto bodyBytes = ToBytes(while_->Body, file);
-
-    constexpr auto ifeqCommandLength = 3;
-    constexpr auto gotoCommandLength = 3;
-    const auto gotoBytesOffset = -static_cast<int16_t>(conditionBytes.size() + bodyBytes.size() + ifeqCommandLength);
-    const auto ifeqBytesOffset = static_cast<int16_t>(bodyBytes.size() + ifeqCommandLength + gotoCommandLength);
-    //  
-    append(bytes, conditionBytes);
-
-    //     
-    append(bytes, (uint8_t)Command::ifeq);
-    append(bytes, ToBytes(ifeqBytesOffset));
-
-    //  
-    append(bytes, bodyBytes);
-
-    //     
-    append(bytes, (uint8_t)Command::goto_);
-    append(bytes, ToBytes((int16_t)gotoBytesOffset));
-
-    append(bytes, (uint8_t)Command::nop);
+    if (condition)
+        ConditionToBytes(condition, true, bodyLabel, file, code);
+    else
+        code.EmitJump(Command::goto_, bodyLabel);
 
-    return bytes;
+    // ,    .
+    //    ,       goto
+    code.Emit(Command::nop);
 }
 
-Bytes ToBytes(DoWhileNode* doWhile, ClassFile& file)
+void ToBytes(WhileNode* while_, ClassFile& file, Assembler& code)
 {
-    Bytes bytes;
+    const auto bodyLabel = code.CreateLabel();
+    const auto conditionLabel = code.CreateLabel();
 
-    const auto conditionBytes = ToBytes(doWhile->Condition, file);
-    const auto bodyBytes = ToBytes(doWhile->Body, file);
+    if (while_->Condition)
+        code.EmitJump(Command::goto_, conditionLabel);
 
-    constexpr auto ifeqCommandLength = 3;
-    constexpr auto gotoCommandLength = 3;
-    const auto gotoBytesOffset = -static_cast<int16_t>(conditionBytes.size() + bodyBytes.size() + ifeqCommandLength);
-    const auto ifeqBytesOffset = static_cast<int16_t>(bodyBytes.size() + ifeqCommandLength + gotoCommandLength);
     //  
-    append(bytes, bodyBytes);
+    code.Bind(bodyLabel);
+    ToBytes(while_->Body, file, code);
 
-    //  
-    append(bytes, conditionBytes);
+    code.Bind(conditionLabel);
+    LoopToBytes(while_->Condition, bodyLabel, file, code);
+}
 
-    //     
-    append(bytes, (uint8_t)Command::ifeq);
-    append(bytes, ToBytes(ifeqBytesOffset));
+void ToBytes(DoWhileNode* doWhile, ClassFile& file, Assembler& code)
+{
+    const auto bodyLabel = code.CreateLabel();
 
     //  
-    append(bytes, bodyBytes);
-
-    //     
-    append(bytes, (uint8_t)Command::goto_);
-    append(bytes, ToBytes((int16_t)gotoBytesOffset));
+    code.Bind(bodyLabel);
+    ToBytes(doWhile->Body, file, code);
 
-    append(bytes, (uint8_t)Command::nop);
-
-    return bytes;
+    LoopToBytes(doWhile->Condition, bodyLabel, file, code);
 }
 
-Bytes ToBytes(ForNode* for_, ClassFile& file)
+void ToBytes(ForNode* for_, ClassFile& file, Assembler& code)
 {
-    Bytes bytes;
-
-    Bytes firstBytes;
+    const auto bodyLabel = code.CreateLabel();
+    const auto conditionLabel = code.CreateLabel();
 
     if (for_->FirstExpr)
-        append(bytes, ToBytes(for_->FirstExpr, file));
+        ExprStmtToBytes(for_->FirstExpr, file, code);
     else if (for_->VarDecl)
-        append(bytes, ToBytes(for_->VarDecl, file));
-
-    const auto conditionBytes = ToBytes(for_->Condition, file);
-    const auto iterExprBytes = ToBytes(for_->IterExpr, file);
-    auto bodyBytes = ToBytes(for_->Body, file);
-    append(bodyBytes, iterExprBytes);
-
-    constexpr auto ifeqCommandLength = 3;
-    constexpr auto gotoCommandLength = 3;
-    const auto gotoBytesOffset = -static_cast<int16_t>(conditionBytes.size() + bodyBytes.size() + ifeqCommandLength);
-    const auto ifeqBytesOffset = static_cast<int16_t>(bodyBytes.size() + ifeqCommandLength + gotoCommandLength);
+        ToBytes(for_->VarDecl, file, code);
 
-    append(bytes, firstBytes);
-
-    //  
-    append(bytes, conditionBytes);
-
-    //     
-    append(bytes, (uint8_t)Command::ifeq);
-    append(bytes, ToBytes(ifeqBytesOffset));
+    if (for_->Condition)
+        code.EmitJump(Command::goto_, conditionLabel);
 
     //  
-    append(bytes, bodyBytes);
-
-    //     
-    append(bytes, (uint8_t)Command::goto_);
-    append(bytes, ToBytes((int16_t)gotoBytesOffset));
-
-    append(bytes, (uint8_t)Command::nop);
+    code.Bind(bodyLabel);
+    ToBytes(for_->Body, file, code);
+    ExprStmtToBytes(for_->IterExpr, file, code);
 
-    return bytes;
+    code.Bind(conditionLabel);
+    LoopToBytes(for_->Condition, bodyLabel, file, code);
 }
 
-Bytes ToBytes(StmtNode* stmt, ClassFile& file)
+void ToBytes(StmtNode* stmt, ClassFile& file, Assembler& code)
 {
     if (!stmt)
-        return {};
-    Bytes bytes;
+        return;
 
     switch (stmt->Type)
     {
         case StmtNode::TypeT::Empty:
-            return bytes;
+            return;
         case StmtNode::TypeT::VarDecl:
-            return ToBytes(stmt->VarDecl, file);
+            ToBytes(stmt->VarDecl, file, code);
+            return;
         case StmtNode::TypeT::While:
-            return ToBytes(stmt->While, file);
+            ToBytes(stmt->While, file, code);
+            return;
         case StmtNode::TypeT::DoWhile:
-            return ToBytes(stmt->DoWhile, file);
+            ToBytes(stmt->DoWhile, file, code);
+            return;
         case StmtNode::TypeT::For:
-            return ToBytes(stmt->For, file);
+            ToBytes(stmt->For, file, code);
+            return;
         case StmtNode::TypeT::Foreach:
             break;
         case StmtNode::TypeT::BlockStmt:
-            return ToBytes(stmt->Block, file);
+            ToBytes(stmt->Block, file, code);
+            return;
         case StmtNode::TypeT::IfStmt:
-            return ToBytes(stmt->If, file);
+            ToBytes(stmt->If, file, code);
+            return;
         case StmtNode::TypeT::Return:
-            return ReturnToBytes(stmt->Expr, file);
+            ReturnToBytes(stmt->Expr, file, code);
+            return;
         case StmtNode::TypeT::ExprStmt:
-            return ToBytes(stmt->Expr, file);
+            ExprStmtToBytes(stmt->Expr, file, code);
+            return;
         default: ;
     }
-    return {};
 }
 
-Bytes ToBytes(MethodDeclNode* method, ClassFile& classFile)
+// Writes the Code attribute body: max_stack, max_locals, the instructions and their StackMapTable
+void CodeToBytes(Assembler& code, std::string_view thisClass, std::string_view descriptor, const bool isStatic,
+                 const bool isConstructor, const int localsCount, ClassFile& classFile, ByteWriter& bytes)
 {
-    Bytes bytes;
+    code.RemoveUnreachable();
+
+    classFile.CodeLengthBeforePeephole += code.Length();
+    RunPeephole(code, classFile.Peephole);
+
+    const auto stackSize = code.ComputeMaxStack(classFile.Constants);
+    bytes.WriteU2(stackSize);
 
-    constexpr auto stackSize = (uint16_t)1000;
-    append(bytes, ToBytes(stackSize));
+    if (localsCount > std::numeric_limits<uint16_t>::max())
+        throw std::runtime_error{ "Method needs more than 65535 local variable slots" };
+    const auto localVariablesCount = (uint16_t)localsCount;
 
-    const uint16_t localVariablesCount = method->Variables.size();
+    bytes.WriteU2(localVariablesCount);
 
-    append(bytes, ToBytes(localVariablesCount));
+    const auto codeLengthPosition = bytes.WritePlaceholder(sizeof(uint32_t));
+    const auto codeStart = bytes.Position();
+    const auto offsets = code.Assemble(bytes);
+    bytes.PatchU4(codeLengthPosition, (uint32_t)(bytes.Position() - codeStart));
+    classFile.CodeLength += bytes.Position() - codeStart;
+
+    constexpr auto exceptionTableSize = (uint16_t)0;
+    bytes.WriteU2(exceptionTableSize);
 
-    Bytes codeBytes;
+    // Class files of version 50+ are checked by the type-checking verifier,
+    // which needs a stack map frame at every jump target
+    const auto entryLocals = EntryLocals(classFile.Constants, thisClass, descriptor, isStatic, isConstructor,
+                                         localVariablesCount);
+    const auto frames = InferFrames(code, offsets, classFile.Constants, thisClass, entryLocals);
+
+    const auto attributesTableSize = (uint16_t)(frames.empty() ? 0 : 1);
+    bytes.WriteU2(attributesTableSize);
+    if (!frames.empty())
+    {
+        bytes.WriteU2(classFile.Constants.FindUtf8("StackMapTable"));
+        const auto attributeLengthPosition = bytes.WritePlaceholder(sizeof(uint32_t));
+        WriteStackMapTable(bytes, frames, entryLocals, offsets);
+        bytes.PatchU4(attributeLengthPosition,
+                      (uint32_t)(bytes.Position() - attributeLengthPosition - sizeof(uint32_t)));
+    }
+}
+
+void ToBytes(MethodDeclNode* method, std::string_view descriptor, ClassFile& classFile, ByteWriter& bytes)
+{
+    Assembler code;
 
     if (method->IsConstructor)
     {
-        append(codeBytes, (uint8_t)Command::aload_0);
-        append(codeBytes, (uint8_t)Command::invokespecial);
+        code.Emit(Command::aload_0);
         const auto javaBaseObjectConstructor = classFile.Constants.FindMethodRef(
              JAVA_OBJECT_TYPE.ToTypename(),
              "<init>",
              "()V"
             );
-        append(codeBytes, ToBytes(javaBaseObjectConstructor));
+        code.Emit(Command::invokespecial, javaBaseObjectConstructor);
     }
 
-    for (auto* stmt : method->Body->GetSeq()) { append(codeBytes, ToBytes(stmt, classFile)); }
-
-    append(codeBytes, (uint8_t)Command::return_);
+    for (auto* stmt : method->Body->GetSeq()) { ToBytes(stmt, classFile, code); }
 
-    append(bytes, ToBytes((uint32_t)codeBytes.size()));
-    append(bytes, codeBytes);
-
-    constexpr auto exceptionTableSize = (uint16_t)0;
-    constexpr auto attributesTableSize = (uint16_t)0;
-
-    append(bytes, ToBytes(exceptionTableSize));
-    append(bytes, ToBytes(attributesTableSize));
-
-    return bytes;
+    code.Emit(Command::return_);
+    CodeToBytes(code, classFile.ClassName, descriptor, method->IsStatic, method->IsConstructor, method->LocalsCount,
+                classFile, bytes);
 }
 
-Bytes ToBytes(JvmMethod method, ClassFile& classFile)
+// Writes method_info up to the Code attribute, then the attribute written by writeCode
+template <typename CodeWriter>
+void MethodToBytes(const AccessFlags accessFlags, const IdT nameId, const IdT typeId, ClassFile& classFile,
+                   ByteWriter& bytes, CodeWriter const& writeCode)
 {
-    Bytes bytes;
-    append(bytes, ToBytes(static_cast<uint16_t>(method.AccessFlags)));
-    append(bytes, ToBytes(method.NameId));
-    append(bytes, ToBytes(method.TypeId));
+    // Generated code is usually a few hundred bytes, so most methods never regrow the buffer
+    constexpr auto initialMethodCapacity = 512;
+
+    bytes.Reserve(initialMethodCapacity);
+    bytes.WriteU2(static_cast<uint16_t>(accessFlags));
+    bytes.WriteU2(nameId);
+    bytes.WriteU2(typeId);
     constexpr auto attributesCount = (uint16_t)1; // The only attribute is Code
-    append(bytes, ToBytes(attributesCount));
-    append(bytes, ToBytes(classFile.Constants.FindUtf8("Code")));
-    const auto codeBytes = ToBytes(method.ActualMethod, classFile);
-    auto codeBytesLength = ToBytes((uint32_t)codeBytes.size());
-    append(bytes, codeBytesLength);
-    append(bytes, codeBytes);
-    return bytes;
+    bytes.WriteU2(attributesCount);
+    bytes.WriteU2(classFile.Constants.FindUtf8("Code"));
+    const auto attributeLengthPosition = bytes.WritePlaceholder(sizeof(uint32_t));
+    writeCode(bytes);
+    bytes.PatchU4(attributeLengthPosition,
+                  (uint32_t)(bytes.Position() - attributeLengthPosition - sizeof(uint32_t)));
 }
 
-#include <filesystem>
-#include <fstream>
-
-void ClassAnalyzer::Generate()
+void ToBytes(JvmMethod method, ClassFile& classFile, ByteWriter& bytes)
 {
-    using namespace std::filesystem;
-    const auto filename = std::string{ CurrentClass->ClassName } + ".class";
-    auto filepath = current_path() / "Output" / Namespace->NamespaceName / filename;
-    create_directory(current_path() / "Output" / Namespace->NamespaceName);
-    std::fstream out{ filepath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc };
-    out << (char)0xCA << (char)0xFE << (char)0xBA << (char)0xBE;
-    const auto minorVersion = ::ToBytes(ClassFile::MinorVersion);
-    out.write((char*)minorVersion.data(), minorVersion.size());
-    const auto majorVersion = ::ToBytes(ClassFile::MajorVersion);
-    out.write((char*)majorVersion.data(), majorVersion.size());
-
-    auto const classBytes = this->ToBytes();
-    auto const constantBytes = ::ToBytes(File.Constants);
-    out.write((char*)constantBytes.data(), constantBytes.size());
-
-    out.write((char*)classBytes.data(), classBytes.size());
-
-    const auto classAttributesCount = ::ToBytes((uint16_t)0);
-    out.write((char*)classAttributesCount.data(), classAttributesCount.size());
+    const auto descriptor = classFile.Constants.Constants[method.TypeId - 1].Utf8;
+    MethodToBytes(method.AccessFlags, method.NameId, method.TypeId, classFile, bytes, [&](ByteWriter& code)
+    {
+        ToBytes(method.ActualMethod, descriptor, classFile, code);
+    });
 }
 
-Bytes ClassAnalyzer::ToBytes()
+// <clinit> that creates the objects of the string literals the methods use
+void StaticInitializerToBytes(ClassFile& classFile, ByteWriter& bytes)
 {
-    Bytes bytes;
-    const auto classConstantId = File.Constants.FindClass(CurrentClass->ToDataType().ToTypename());
-    const auto superClassId = File.Constants.FindClass(JAVA_OBJECT_TYPE.ToTypename());
-    const auto accessFlags = AccessFlags::Super | AccessFlags::Public;
-    append(bytes, ::ToBytes((uint16_t)accessFlags));
-    append(bytes, ::ToBytes(classConstantId));
-    append(bytes, ::ToBytes(superClassId));
-
-    constexpr auto interfacesCount = (uint16_t)0;
-    append(bytes, ::ToBytes(interfacesCount));
+    constexpr std::string_view descriptor = "()V";
+    const auto stringClassId = classFile.Constants.FindClass(STD_STRING_TYPE.ToTypename());
+    const auto constructorId = classFile.Constants.FindMethodRef(STD_STRING_TYPE.ToTypename(),
+                                                                 STD_STRING_CONSTRUCTOR_INFO.Name,
+                                                                 STD_STRING_CONSTRUCTOR_INFO.Descriptor);
+    Assembler code;
+    for (const auto literal : classFile.StringLiterals)
+    {
+        code.Emit(Command::new_, stringClassId);
+        code.Emit(Command::dup);
+        code.Emit(Command::ldc, classFile.Constants.FindString(literal));
+        code.Emit(Command::invokespecial, constructorId);
+        code.Emit(Command::putstatic, classFile.FindStringLiteralField(literal));
+    }
+    code.Emit(Command::return_);
 
-    append(bytes, ::ToBytes((uint16_t)File.Fields.size()));
-    for (auto field : File.Fields) { append(bytes, ::ToBytes(field)); }
+    MethodToBytes(AccessFlags::Static, classFile.Constants.FindUtf8("<clinit>"),
+                  classFile.Constants.FindUtf8(descriptor), classFile, bytes, [&](ByteWriter& method)
+                  {
+                      CodeToBytes(code, classFile.ClassName, descriptor, true, false, 0, classFile, method);
+                  });
+}
 
-    std::sort(File.Methods.begin(), File.Methods.end(), [](auto const& lhs, auto const& rhs)
+// The declared fields followed by the ones of the string literals. File.Fields itself is left as it is,
+// so writing the class once more gives the same fields
+std::vector<JvmField> FieldsWithStringLiterals(ClassFile& classFile)
+{
+    auto fields = classFile.Fields;
+    if (classFile.StringLiterals.empty())
+        return fields;
+    const auto typeId = classFile.Constants.FindUtf8(STD_STRING_TYPE.ToDescriptor());
+    const auto accessFlags = AccessFlags::Private | AccessFlags::Static | AccessFlags::Final;
+    for (size_t i = 0; i < classFile.StringLiterals.size(); ++i)
     {
-        return lhs.ActualMethod->IsConstructor > rhs.ActualMethod->IsConstructor;
-    });
-    append(bytes, ::ToBytes((uint16_t)File.Methods.size()));
-    for (auto method : File.Methods) { append(bytes, ::ToBytes(method, File)); }
-    return bytes;
+        const auto nameId = classFile.Constants.FindUtf8(ClassFile::StringLiteralFieldName(i));
+        fields.push_back({ nameId, typeId, accessFlags });
+    }
+    return fields;
 }
 
-// #include <WinSock2.h>
-// #pragma comment(lib, "Ws2_32.lib")
-Bytes ToBytes(const uint32_t n)
+Bytes ClassAnalyzer::ToClassFile()
 {
-    const auto netNum = n;
-
-    union
-    {
-        uint32_t num;
-        unsigned char bytes[sizeof uint32_t];
-    } u;
+    const auto classConstantId = File.Constants.FindClass(CurrentClass->ToDataType().ToTypename());
+    const auto superClassId = File.Constants.FindClass(JAVA_OBJECT_TYPE.ToTypename());
+    // The methods add constants and the string literal fields, so they are generated first and the pool is written
+    // after them
+    ByteWriter methods;
+    const auto methodsCount = MethodsToBytes(methods);
+    const auto fields = FieldsWithStringLiterals(File);
+
+    // Everything else is known now, so the file is written into one buffer of the exact size:
+    // magic, versions, pool, access flags, this, super, interfaces count, fields, methods, attributes count
+    constexpr size_t fieldSize = 4 * sizeof(uint16_t);
+    const auto size = sizeof(uint32_t) + 2 * sizeof(uint16_t) + SizeInBytes(File.Constants) + 4 * sizeof(uint16_t)
+        + sizeof(uint16_t) + fields.size() * fieldSize + sizeof(uint16_t) + methods.Position() + sizeof(uint16_t);
+    ByteWriter bytes;
+    bytes.Reserve(size);
+
+    bytes.WriteU4(ClassFile::MagicConstant);
+    bytes.WriteU2(ClassFile::MinorVersion);
+    bytes.WriteU2(ClassFile::MajorVersion);
+    ::ToBytes(File.Constants, bytes);
 
-    u.num = netNum;
+    const auto accessFlags = AccessFlags::Super | AccessFlags::Public;
+    bytes.WriteU2((uint16_t)accessFlags);
+    bytes.WriteU2(classConstantId);
+    bytes.WriteU2(superClassId);
+    constexpr auto interfacesCount = (uint16_t)0;
+    bytes.WriteU2(interfacesCount);
 
-    Bytes bytes(sizeof n, '\0');
+    bytes.WriteU2((uint16_t)fields.size());
+    for (auto field : fields) { ::ToBytes(field, bytes); }
 
-    std::copy(std::rbegin(u.bytes), std::rend(u.bytes), bytes.begin());
+    bytes.WriteU2(methodsCount);
+    bytes.Write(methods.Data);
 
-    return bytes;
-}
+    constexpr auto classAttributesCount = (uint16_t)0;
+    bytes.WriteU2(classAttributesCount);
 
-Bytes ToBytes(const int16_t n)
-{
-    Bytes bytes;
-    const auto otherBytes = ToBytes((int32_t)n);
-    bytes.push_back(otherBytes[2]);
-    bytes.push_back(otherBytes[3]);
-    return bytes;
+    if (bytes.Position() != size)
+        throw std::runtime_error{ "Class file size was computed as " + std::to_string(size) + " bytes, but "
+                                  + std::to_string(bytes.Position()) + " were written" };
+    return std::move(bytes.Data);
 }
 
-Bytes ToBytes(const uint16_t n)
+uint16_t ClassAnalyzer::MethodsToBytes(ByteWriter& methods)
 {
-    const auto netNum = n;
-    Bytes bytes(sizeof n, '\0');
-    for (int i = 0; i < bytes.size(); i++)
-        bytes[bytes.size() - 1 - i] = (netNum >> (i * 8));
-    return bytes;
+    std::sort(File.Methods.begin(), File.Methods.end(), [](auto const& lhs, auto const& rhs)
+    {
+        return lhs.ActualMethod->IsConstructor > rhs.ActualMethod->IsConstructor;
+    });
+    for (auto method : File.Methods) { ::ToBytes(method, File, methods); }
+    auto methodsCount = File.Methods.size();
+    if (!File.StringLiterals.empty())
+    {
+        StaticInitializerToBytes(File, methods);
+        ++methodsCount;
+    }
+    if (methodsCount > std::numeric_limits<uint16_t>::max())
+        throw std::runtime_error{ "Class has more than 65535 methods" };
+    return (uint16_t)methodsCount;
 }
 
-Bytes ToBytes(const IntT n)
+size_t SizeInBytes(Constant const& constant)
 {
-    const auto netNum = n;
-    Bytes bytes(sizeof n, '\0');
-    for (int i = 0; i < bytes.size(); i++)
-        bytes[bytes.size() - 1 - i] = (netNum >> (i * 8));
-    return bytes;
+    // The tag, then the data
+    constexpr size_t tagSize = 1;
+    switch (constant.Type)
+    {
+        case Constant::TypeT::Utf8:
+            return tagSize + sizeof(uint16_t) + constant.Utf8.size();
+        case Constant::TypeT::Integer:
+        case Constant::TypeT::Float:
+            return tagSize + sizeof(uint32_t);
+        case Constant::TypeT::String:
+        case Constant::TypeT::Class:
+            return tagSize + sizeof(uint16_t);
+        case Constant::TypeT::NameAndType:
+        case Constant::TypeT::MethodRef:
+        case Constant::TypeT::FieldRef:
+            return tagSize + 2 * sizeof(uint16_t);
+        default:
+            return tagSize;
+    }
 }
 
-Bytes ToBytes(Constant const& constant)
+void ToBytes(Constant const& constant, ByteWriter& bytes)
 {
-    Bytes bytes;
-    append(bytes, static_cast<uint8_t>(constant.Type));
+    bytes.Write(static_cast<uint8_t>(constant.Type));
     switch (constant.Type)
     {
         case Constant::TypeT::Utf8:
-            append(bytes, ToBytes((uint16_t)constant.Utf8.size()));
-            append(bytes, constant.Utf8);
+            bytes.WriteU2((uint16_t)constant.Utf8.size());
+            bytes.Write(std::string_view{ constant.Utf8 });
             break;
         case Constant::TypeT::Integer:
-            append(bytes, ToBytes(constant.Integer));
+            bytes.WriteI4(constant.Integer);
             break;
         case Constant::TypeT::Float:
             throw std::runtime_error{ "Float is not supported" };
         case Constant::TypeT::String:
-            append(bytes, ToBytes(constant.Utf8Id));
+            bytes.WriteU2(constant.Utf8Id);
             break;
         case Constant::TypeT::NameAndType:
-            append(bytes, ToBytes(constant.NameId));
-            append(bytes, ToBytes(constant.TypeId));
+            bytes.WriteU2(constant.NameId);
+            bytes.WriteU2(constant.TypeId);
             break;
         case Constant::TypeT::Class:
-            append(bytes, ToBytes(constant.ClassNameId));
+            bytes.WriteU2(constant.ClassNameId);
             break;
         case Constant::TypeT::MethodRef:
         case Constant::TypeT::FieldRef:
-            append(bytes, ToBytes(constant.ClassId));
-            append(bytes, ToBytes(constant.NameAndTypeId));
+            bytes.WriteU2(constant.ClassId);
+            bytes.WriteU2(constant.NameAndTypeId);
             break;
         default: ;
     }
-    return bytes;
 }
@@ -2,26 +2,16 @@
 #include <string>
 #include <cstdint>
 #include <vector>
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
 #include "../Tree/Program.h"
+#include "ByteWriter.h"
+#include "Peephole.h"
 
 using IdT = uint16_t;
 using IntT = std::int32_t;
 using FloatT = double;
-using Bytes = std::vector<unsigned char>;
-
-inline void append(Bytes& bytes, Bytes::value_type value) { bytes.push_back(value); }
-
-inline void append(Bytes& bytes, Bytes const& value) { bytes.insert(bytes.end(), value.begin(), value.end()); }
-
-inline void append(Bytes& bytes, std::string_view value) { bytes.insert(bytes.end(), value.begin(), value.end()); }
-
-Bytes ToBytes(uint32_t n);
-
-Bytes ToBytes(uint16_t n);
-
-Bytes ToBytes(IntT n);
-
-Bytes ToBytes(int16_t n);
 
 struct Constant
 {
@@ -72,13 +62,28 @@ struct Constant
     static Constant CreateMethodRef(IdT natId, IdT classId);
 };
 
-Bytes ToBytes(Constant const& constant);
+void ToBytes(Constant const& constant, ByteWriter& bytes);
+
+// Bytes the constant takes in the pool
+[[nodiscard]] size_t SizeInBytes(Constant const& constant);
 
 struct ConstantTable
 {
-    std::vector<Constant> Constants;
+    // std::deque keeps references stable on push_back, so Utf8Ids can key by views into Constants
+    std::deque<Constant> Constants;
     using ConstantRef = Constant const&;
 
+    ConstantTable() = default;
+
+    // A copy of Utf8Ids would still view into the original's Constants. Moving keeps the elements in place
+    ConstantTable(const ConstantTable&) = delete;
+
+    ConstantTable& operator=(const ConstantTable&) = delete;
+
+    ConstantTable(ConstantTable&&) = default;
+
+    ConstantTable& operator=(ConstantTable&&) = default;
+
     IdT FindUtf8(std::string_view utf8);
 
     IdT FindString(std::string_view str);
@@ -94,10 +99,29 @@ struct ConstantTable
     IdT FindFieldRef(std::string_view className, std::string_view name, std::string_view type);
 
     IdT FindMethodRef(std::string_view className, std::string_view name, std::string_view type);
+
+private:
+    // Indices per constant kind, so lookups neither scan the whole pool nor allocate
+    std::unordered_map<std::string_view, IdT> Utf8Ids;
+    std::unordered_map<IntT, IdT> IntIds;
+    // Keyed by the bits of the value: -0.0 stays apart from 0.0 and a NaN is found again
+    std::unordered_map<uint64_t, IdT> FloatIds;
+    std::unordered_map<IdT, IdT> StringIds;
+    std::unordered_map<IdT, IdT> ClassIds;
+    // Keyed by both referenced ids packed into one number, see PackIds
+    std::unordered_map<uint32_t, IdT> NaTIds;
+    std::unordered_map<uint32_t, IdT> FieldRefIds;
+    std::unordered_map<uint32_t, IdT> MethodRefIds;
+
+    static uint32_t PackIds(IdT first, IdT second) { return (uint32_t)first << 16 | second; }
+
+    IdT Add(Constant constant);
 };
 
 
-Bytes ToBytes(const ConstantTable& constants);
+void ToBytes(const ConstantTable& constants, ByteWriter& bytes);
+
+[[nodiscard]] size_t SizeInBytes(const ConstantTable& constants);
 
 enum class AccessFlags : uint16_t
 {
@@ -142,7 +166,7 @@ struct JvmField
     AccessFlags AccessFlags;
 };
 
-Bytes ToBytes(JvmField field);
+void ToBytes(JvmField field, ByteWriter& bytes);
 
 struct JvmMethod
 {
@@ -166,9 +190,28 @@ struct ClassFile
     ConstantTable Constants;
     std::vector<JvmField> Fields;
     std::vector<JvmMethod> Methods;
+
+    PeepholeOptions Peephole{};
+    // Code bytes of the methods before and after the peephole pass
+    size_t CodeLengthBeforePeephole = 0;
+    size_t CodeLength = 0;
+
+    // Internal name of the class, the owner of the string literal fields
+    std::string ClassName;
+    // Distinct string literals in the order of first use. Each one is created once in <clinit>
+    // and kept in a static final field, see StringLiteralFieldName
+    std::vector<std::string_view> StringLiterals;
+
+    // FieldRef of the static field holding the literal
+    IdT FindStringLiteralField(std::string_view literal);
+
+    [[nodiscard]] static std::string StringLiteralFieldName(size_t index);
+
+private:
+    std::unordered_map<std::string_view, IdT> StringLiteralFieldIds;
 };
 
-Bytes ToBytes(JvmMethod method, ClassFile& classFile);
+void ToBytes(JvmMethod method, ClassFile& classFile, ByteWriter& bytes);
 
 struct ClassAnalyzer
 {
@@ -189,8 +232,11 @@ struct ClassAnalyzer
         {
             for (auto* varDecl : CurrentMethod->Variables)
             {
-                if (varDecl->ScopingLevel == CurrentScopingLevel)
-                    varDecl->Identifier = "";
+                if (varDecl->ScopingLevel == CurrentScopingLevel && !varDecl->Identifier.IsEmpty())
+                {
+                    varDecl->Identifier = {};
+                    CurrentMethod->NextFreeSlot = std::min(CurrentMethod->NextFreeSlot, varDecl->PositionInMethod);
+                }
             }
             CurrentScopingLevel--;
         }
@@ -258,7 +304,10 @@ struct ClassAnalyzer
 
     void FillTables();
 
-    void Generate();
+    // Contents of the .class file
+    [[nodiscard]] Bytes ToClassFile();
 
-    Bytes ToBytes();
+    // Writes the methods and the <clinit> of the string literals they use, adding the fields of the literals.
+    // Returns the number of methods written
+    uint16_t MethodsToBytes(ByteWriter& methods);
 };
@@ -36,13 +36,16 @@ enum class Command : uint8_t
     if_icmpge = 0xA2,
     ifeq = 0x99,
     ifne = 0x9A,
-    iflt = 0x55,
+    iflt = 0x9B,
     ifle = 0x9E,
     ifgt = 0x9D,
     ifge = 0x9C,
     if_acmpeq = 0xA5,
     if_acmpne = 0xA6,
     goto_ = 0xA7,
+    goto_w = 0xC8,
+    ifnull = 0xC6,
+    ifnonnull = 0xC7,
     tableswitch = 0xAA,
     lookupswitch = 0xAB,
     newarray = 0xBC,
@@ -53,6 +56,8 @@ enum class Command : uint8_t
     iastore = 0x4F,
     aastore = 0x53,
     new_ = 0xBB,
+    getstatic = 0xB2,
+    putstatic = 0xB3,
     getfield = 0xB4,
     putfield = 0xB5,
     instanceof = 0xC1,
@@ -64,6 +69,10 @@ enum class Command : uint8_t
     areturn = 0xB0,
     return_ = 0xB1,
     aload_0 = 0x2A,
+    iload_0 = 0x1A,
+    istore_0 = 0x3B,
+    astore_0 = 0x4B,
+    wide = 0xC4,
     aconst_null = 0x1,
     nop = 0,
     ineg = 0x74,
@@ -0,0 +1,466 @@
+#include "ConstantFolding.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+    // Value of an int, bool or char literal as the JVM holds it on the operand stack
+    struct Constant
+    {
+        DataType::TypeT Type{};
+        int32_t Value = 0;
+    };
+
+    std::optional<Constant> AsConstant(ExprNode* expr)
+    {
+        if (!expr || expr->Type != ExprNode::TypeT::AccessExpr)
+            return std::nullopt;
+        auto* access = expr->Access;
+        switch (access->Type) // NOLINT(clang-diagnostic-switch-enum)
+        {
+            case AccessExpr::TypeT::Integer:
+                return Constant{ DataType::TypeT::Int, access->Integer };
+            case AccessExpr::TypeT::Bool:
+                return Constant{ DataType::TypeT::Bool, access->Bool ? 1 : 0 };
+            case AccessExpr::TypeT::Char:
+                // bipush sign-extends the char the same way
+                return Constant{ DataType::TypeT::Char, (int8_t)access->Char };
+            default:
+                return std::nullopt;
+        }
+    }
+
+    ExprNode* MakeLiteral(const Constant constant)
+    {
+        AccessExpr* access;
+        switch (constant.Type) // NOLINT(clang-diagnostic-switch-enum)
+        {
+            case DataType::TypeT::Int:
+                access = AccessExpr::FromInt(constant.Value);
+                break;
+            case DataType::TypeT::Bool:
+                access = AccessExpr::FromBool(constant.Value != 0);
+                break;
+            case DataType::TypeT::Char:
+                access = AccessExpr::FromChar((char)constant.Value);
+                break;
+            default:
+                throw std::runtime_error{ "Internal error: only int, bool and char literals are folded" };
+        }
+        access->AType = DataType{ constant.Type };
+        auto* node = ExprNode::FromAccessExpr(access);
+        node->AType = access->AType;
+        return node;
+    }
+
+    // int arithmetic of the JVM: the result keeps the low 32 bits
+    int32_t Wrap(const int64_t value)
+    {
+        return (int32_t)(uint32_t)(uint64_t)value;
+    }
+
+    std::optional<int32_t> FoldArithmetic(const ExprNode::TypeT type, const int32_t lhs, const int32_t rhs)
+    {
+        switch (type) // NOLINT(clang-diagnostic-switch-enum)
+        {
+            case ExprNode::TypeT::BinPlus:
+                return Wrap((int64_t)lhs + rhs);
+            case ExprNode::TypeT::BinMinus:
+                return Wrap((int64_t)lhs - rhs);
+            case ExprNode::TypeT::Multiply:
+                return Wrap((int64_t)lhs * rhs);
+            case ExprNode::TypeT::Divide:
+                if (rhs == 0)
+                    return std::nullopt;
+                // idiv overflows to the dividend itself
+                if (lhs == std::numeric_limits<int32_t>::min() && rhs == -1)
+                    return lhs;
+                return lhs / rhs;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    std::optional<bool> FoldComparison(const ExprNode::TypeT type, const int32_t lhs, const int32_t rhs)
+    {
+        switch (type) // NOLINT(clang-diagnostic-switch-enum)
+        {
+            case ExprNode::TypeT::Less:
+                return lhs < rhs;
+            case ExprNode::TypeT::Greater:
+                return lhs > rhs;
+            case ExprNode::TypeT::Equal:
+                return lhs == rhs;
+            case ExprNode::TypeT::NotEqual:
+                return lhs != rhs;
+            case ExprNode::TypeT::GreaterOrEqual:
+                return lhs >= rhs;
+            case ExprNode::TypeT::LessOrEqual:
+                return lhs <= rhs;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    ExprNode* FoldBinary(ExprNode* expr)
+    {
+        const auto lhs = AsConstant(expr->Left);
+        const auto rhs = AsConstant(expr->Right);
+
+        // A literal on the left decides && and || without evaluating the right side
+        if ((expr->Type == ExprNode::TypeT::And || expr->Type == ExprNode::TypeT::Or) &&
+            lhs && lhs->Type == DataType::TypeT::Bool && expr->Right->AType == DataType::BoolType)
+        {
+            const auto decides = (lhs->Value != 0) == (expr->Type == ExprNode::TypeT::Or);
+            return decides ? expr->Left : expr->Right;
+        }
+
+        if (!lhs || !rhs || lhs->Type != rhs->Type)
+            return expr;
+
+        if (IsComparison(expr->Type))
+        {
+            const auto isOrdering = expr->Type != ExprNode::TypeT::Equal && expr->Type != ExprNode::TypeT::NotEqual;
+            if (isOrdering && lhs->Type == DataType::TypeT::Bool)
+                return expr;
+            if (const auto result = FoldComparison(expr->Type, lhs->Value, rhs->Value))
+                return MakeLiteral({ DataType::TypeT::Bool, *result });
+            return expr;
+        }
+
+        // Arithmetic on chars stays, a char literal cannot hold every int result the JVM computes
+        if (lhs->Type == DataType::TypeT::Int)
+        {
+            if (const auto result = FoldArithmetic(expr->Type, lhs->Value, rhs->Value))
+                return MakeLiteral({ DataType::TypeT::Int, *result });
+        }
+        return expr;
+    }
+
+    ExprNode* FoldUnary(ExprNode* expr)
+    {
+        const auto operand = AsConstant(expr->Child);
+        if (!operand)
+            return expr;
+        if (expr->Type == ExprNode::TypeT::Not && operand->Type == DataType::TypeT::Bool)
+            return MakeLiteral({ DataType::TypeT::Bool, operand->Value == 0 });
+        if (operand->Type != DataType::TypeT::Int)
+            return expr;
+        if (expr->Type == ExprNode::TypeT::UnaryMinus)
+            return MakeLiteral({ DataType::TypeT::Int, Wrap(-(int64_t)operand->Value) });
+        if (expr->Type == ExprNode::TypeT::UnaryPlus)
+            return expr->Child;
+        return expr;
+    }
+
+    // Folds the node itself, its operands have to be folded already
+    ExprNode* FoldNode(ExprNode* expr)
+    {
+        if (expr->OverloadedOperation)
+            return expr;
+        if (expr->Type == ExprNode::TypeT::AccessExpr && expr->Access->Type == AccessExpr::TypeT::Expr)
+        {
+            // Parentheses around a literal
+            if (AsConstant(expr->Access->Child))
+                return expr->Access->Child;
+            return expr;
+        }
+        if (expr->Type == ExprNode::TypeT::Not || expr->Type == ExprNode::TypeT::UnaryMinus ||
+            expr->Type == ExprNode::TypeT::UnaryPlus)
+            return FoldUnary(expr);
+        if (IsBinary(expr->Type) && expr->Type != ExprNode::TypeT::Assign)
+            return FoldBinary(expr);
+        return expr;
+    }
+
+    using ExprVisitor = std::function<void(ExprNode*&)>;
+
+    void VisitExprs(ExprNode*& expr, const ExprVisitor& visit);
+
+    void VisitExprs(AccessExpr* access, const ExprVisitor& visit)
+    {
+        if (!access)
+            return;
+        VisitExprs(access->Previous, visit);
+        if (access->Child)
+            VisitExprs(access->Child, visit);
+        if (access->Arguments)
+        {
+            for (auto*& argument : access->Arguments->GetSeq())
+                VisitExprs(argument, visit);
+        }
+    }
+
+    // Calls visit for every expression in the tree, operands before the operator
+    void VisitExprs(ExprNode*& expr, const ExprVisitor& visit)
+    {
+        if (!expr)
+            return;
+        VisitExprs(expr->Left, visit);
+        VisitExprs(expr->Right, visit);
+        VisitExprs(expr->Child, visit);
+        VisitExprs(expr->IndexExpr, visit);
+        VisitExprs(expr->AssignExpr, visit);
+        if (expr->ExprSeq)
+        {
+            for (auto*& element : expr->ExprSeq->GetSeq())
+                VisitExprs(element, visit);
+        }
+        VisitExprs(expr->Access, visit);
+        VisitExprs(expr->ArrayExpr, visit);
+        VisitExprs(expr->ObjectExpr, visit);
+        visit(expr);
+    }
+
+    void VisitExprs(StmtNode* stmt, const ExprVisitor& visit)
+    {
+        if (!stmt)
+            return;
+        if (stmt->VarDecl)
+            VisitExprs(stmt->VarDecl->InitExpr, visit);
+        if (auto* while_ = stmt->While)
+        {
+            VisitExprs(while_->Condition, visit);
+            VisitExprs(while_->Body, visit);
+        }
+        if (auto* doWhile = stmt->DoWhile)
+        {
+            VisitExprs(doWhile->Condition, visit);
+            VisitExprs(doWhile->Body, visit);
+        }
+        if (auto* for_ = stmt->For)
+        {
+            if (for_->VarDecl)
+                VisitExprs(for_->VarDecl->InitExpr, visit);
+            VisitExprs(for_->FirstExpr, visit);
+            VisitExprs(for_->Condition, visit);
+            VisitExprs(for_->IterExpr, visit);
+            VisitExprs(for_->Body, visit);
+        }
+        if (auto* forEach = stmt->ForEach)
+        {
+            VisitExprs(forEach->Expr, visit);
+            VisitExprs(forEach->Body, visit);
+        }
+        if (auto* if_ = stmt->If)
+        {
+            VisitExprs(if_->Condition, visit);
+            VisitExprs(if_->ThenBranch, visit);
+            VisitExprs(if_->ElseBranch, visit);
+        }
+        VisitExprs(stmt->Expr, visit);
+        if (stmt->Block)
+        {
+            for (auto* s : stmt->Block->GetSeq())
+                VisitExprs(s, visit);
+        }
+    }
+
+    std::optional<bool> ConstantCondition(ExprNode* condition)
+    {
+        if (const auto value = AsConstant(condition); value && value->Type == DataType::TypeT::Bool)
+            return value->Value != 0;
+        return std::nullopt;
+    }
+
+    // Whether control never gets to the statement after stmt. The language has no break,
+    // so a loop without a condition never ends
+    bool NeverCompletes(StmtNode* stmt)
+    {
+        if (!stmt)
+            return false;
+        switch (stmt->Type)
+        {
+            case StmtNode::TypeT::Return:
+                return true;
+            case StmtNode::TypeT::BlockStmt:
+            {
+                auto const& seq = stmt->Block->GetSeq();
+                return std::any_of(seq.begin(), seq.end(), NeverCompletes);
+            }
+            case StmtNode::TypeT::IfStmt:
+                return NeverCompletes(stmt->If->ThenBranch) && NeverCompletes(stmt->If->ElseBranch);
+            case StmtNode::TypeT::While:
+                return stmt->While->Condition == nullptr;
+            case StmtNode::TypeT::DoWhile:
+                return stmt->DoWhile->Condition == nullptr || NeverCompletes(stmt->DoWhile->Body);
+            case StmtNode::TypeT::For:
+                return stmt->For->Condition == nullptr;
+            default:
+                return false;
+        }
+    }
+
+    StmtNode* PruneStmt(StmtNode* stmt);
+
+    void PruneSeq(std::vector<StmtNode*>& seq)
+    {
+        for (size_t i = 0; i < seq.size(); ++i)
+        {
+            seq[i] = PruneStmt(seq[i]);
+            if (NeverCompletes(seq[i]))
+            {
+                seq.resize(i + 1);
+                return;
+            }
+        }
+    }
+
+    // Returns the statement that replaces stmt
+    StmtNode* PruneStmt(StmtNode* stmt)
+    {
+        if (!stmt)
+            return nullptr;
+        switch (stmt->Type)
+        {
+            case StmtNode::TypeT::BlockStmt:
+                PruneSeq(stmt->Block->GetSeq());
+                return stmt;
+            case StmtNode::TypeT::IfStmt:
+            {
+                auto* if_ = stmt->If;
+                if (const auto condition = ConstantCondition(if_->Condition))
+                {
+                    auto* taken = *condition ? if_->ThenBranch : if_->ElseBranch;
+                    return taken ? PruneStmt(taken) : new StmtNode;
+                }
+                if_->ThenBranch = PruneStmt(if_->ThenBranch);
+                if_->ElseBranch = PruneStmt(if_->ElseBranch);
+                return stmt;
+            }
+            case StmtNode::TypeT::While:
+            {
+                auto* while_ = stmt->While;
+                if (const auto condition = ConstantCondition(while_->Condition))
+                {
+                    if (!*condition)
+                        return new StmtNode;
+                    while_->Condition = nullptr;
+                }
+                while_->Body = PruneStmt(while_->Body);
+                return stmt;
+            }
+            case StmtNode::TypeT::DoWhile:
+            {
+                auto* doWhile = stmt->DoWhile;
+                doWhile->Body = PruneStmt(doWhile->Body);
+                if (const auto condition = ConstantCondition(doWhile->Condition))
+                {
+                    // The body runs once before the condition is checked
+                    if (!*condition)
+                        return doWhile->Body;
+                    doWhile->Condition = nullptr;
+                }
+                return stmt;
+            }
+            case StmtNode::TypeT::For:
+            {
+                auto* for_ = stmt->For;
+                if (const auto condition = ConstantCondition(for_->Condition))
+                {
+                    // The initialization still runs
+                    if (!*condition)
+                    {
+                        if (for_->FirstExpr)
+                            return new StmtNode(for_->FirstExpr, false);
+                        if (for_->VarDecl)
+                            return new StmtNode(for_->VarDecl);
+                        return new StmtNode;
+                    }
+                    for_->Condition = nullptr;
+                }
+                for_->Body = PruneStmt(for_->Body);
+                return stmt;
+            }
+            case StmtNode::TypeT::Foreach:
+                stmt->ForEach->Body = PruneStmt(stmt->ForEach->Body);
+                return stmt;
+            default:
+                return stmt;
+        }
+    }
+
+    VarDeclNode* AssignedVariable(ExprNode* target)
+    {
+        if (target && target->Type == ExprNode::TypeT::AccessExpr && target->Access)
+            return target->Access->ActualVar;
+        return nullptr;
+    }
+}
+
+ExprNode* FoldConstants(ExprNode* expr)
+{
+    VisitExprs(expr, [](ExprNode*& node) { node = FoldNode(node); });
+    return expr;
+}
+
+void PropagateConstants(MethodDeclNode* method)
+{
+    auto& body = method->Body->GetSeq();
+    const auto visitBody = [&body](const ExprVisitor& visit)
+    {
+        for (auto* stmt : body)
+            VisitExprs(stmt, visit);
+    };
+
+    std::unordered_set<VarDeclNode*> assigned;
+    visitBody([&assigned](ExprNode*& expr)
+    {
+        switch (expr->Type) // NOLINT(clang-diagnostic-switch-enum)
+        {
+            case ExprNode::TypeT::Assign:
+            case ExprNode::TypeT::Plus_assign:
+            case ExprNode::TypeT::Minus_assign:
+            case ExprNode::TypeT::Multiply_assign:
+            case ExprNode::TypeT::Division_assign:
+                assigned.insert(AssignedVariable(expr->Left));
+                break;
+            case ExprNode::TypeT::Increment:
+            case ExprNode::TypeT::Decrement:
+                assigned.insert(AssignedVariable(expr->Child));
+                break;
+            default: ;
+        }
+    });
+
+    // A replaced read can make another initializer constant, so repeat until nothing new turns up
+    std::unordered_map<VarDeclNode*, Constant> constants;
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        for (auto* variable : method->Variables)
+        {
+            if (constants.count(variable) || assigned.count(variable))
+                continue;
+            if (const auto value = AsConstant(variable->InitExpr); value && DataType{ value->Type } == variable->AType)
+            {
+                constants.emplace(variable, *value);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+
+        visitBody([&constants](ExprNode*& expr)
+        {
+            if (expr->Type == ExprNode::TypeT::AccessExpr && expr->Access->Type == AccessExpr::TypeT::Identifier)
+            {
+                if (const auto found = constants.find(expr->Access->ActualVar); found != constants.end())
+                    expr = MakeLiteral(found->second);
+                return;
+            }
+            expr = FoldNode(expr);
+        });
+    }
+}
+
+void PruneDeadCode(MethodDeclNode* method)
+{
+    PruneSeq(method->Body->GetSeq());
+}
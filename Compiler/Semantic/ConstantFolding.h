@@ -0,0 +1,16 @@
+#pragma once
+#include "../Tree/Program.h"
+
+// Replaces operators on int, bool and char literals with their result, computed the way the JVM would
+// (int arithmetic wraps around). Division by zero stays in the code so that it still throws at runtime.
+// Operands must already have their types calculated
+[[nodiscard]] ExprNode* FoldConstants(ExprNode* expr);
+
+// Replaces reads of local variables that are initialized with a literal and never assigned again
+// by that literal, then folds the expressions that become constant
+void PropagateConstants(MethodDeclNode* method);
+
+// Drops if branches and loops whose condition is a literal false and statements that can never run
+// because a return or an endless loop comes before them. A literal true loop condition is removed
+// so the loop is emitted without the test
+void PruneDeadCode(MethodDeclNode* method);
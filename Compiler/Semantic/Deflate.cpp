@@ -0,0 +1,191 @@
+#include "Deflate.h"
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace
+{
+    constexpr size_t WindowSize = 32768;
+    constexpr size_t MinMatch = 3;
+    constexpr size_t MaxMatch = 258;
+    // Candidates checked per position, bounds the time spent on highly repetitive data
+    constexpr size_t MaxChainLength = 128;
+    constexpr size_t HashBits = 15;
+    constexpr auto NoPosition = static_cast<size_t>(-1);
+
+    constexpr std::array<uint16_t, 29> LengthBases{
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    constexpr std::array<uint8_t, 29> LengthExtraBits{
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+    };
+    constexpr std::array<uint16_t, 30> DistanceBases{
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097,
+        6145, 8193, 12289, 16385, 24577
+    };
+    constexpr std::array<uint8_t, 30> DistanceExtraBits{
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+    };
+
+    // Deflate packs values starting from the least significant bit of each byte
+    struct BitWriter
+    {
+        Bytes Data;
+        uint32_t Buffer = 0;
+        int Count = 0;
+
+        void Write(const uint32_t value, const int bits)
+        {
+            Buffer |= value << Count;
+            Count += bits;
+            while (Count >= 8)
+            {
+                Data.push_back(static_cast<uint8_t>(Buffer));
+                Buffer >>= 8;
+                Count -= 8;
+            }
+        }
+
+        // Huffman codes are stored starting from their most significant bit
+        void WriteCode(const uint32_t code, const int bits)
+        {
+            uint32_t reversed = 0;
+            for (int i = 0; i < bits; ++i)
+                reversed |= (code >> i & 1) << (bits - 1 - i);
+            Write(reversed, bits);
+        }
+
+        void Flush()
+        {
+            if (Count > 0)
+                Data.push_back(static_cast<uint8_t>(Buffer));
+            Buffer = 0;
+            Count = 0;
+        }
+    };
+
+    // Fixed literal/length code, RFC 1951 3.2.6
+    void WriteSymbol(BitWriter& bits, const uint32_t symbol)
+    {
+        if (symbol < 144)
+            bits.WriteCode(0x30 + symbol, 8);
+        else if (symbol < 256)
+            bits.WriteCode(0x190 + symbol - 144, 9);
+        else if (symbol < 280)
+            bits.WriteCode(symbol - 256, 7);
+        else
+            bits.WriteCode(0xC0 + symbol - 280, 8);
+    }
+
+    void WriteMatch(BitWriter& bits, const size_t length, const size_t distance)
+    {
+        size_t lengthCode = LengthBases.size() - 1;
+        while (LengthBases[lengthCode] > length)
+            --lengthCode;
+        WriteSymbol(bits, 257 + (uint32_t)lengthCode);
+        bits.Write((uint32_t)(length - LengthBases[lengthCode]), LengthExtraBits[lengthCode]);
+
+        size_t distanceCode = DistanceBases.size() - 1;
+        while (DistanceBases[distanceCode] > distance)
+            --distanceCode;
+        bits.WriteCode((uint32_t)distanceCode, 5);
+        bits.Write((uint32_t)(distance - DistanceBases[distanceCode]), DistanceExtraBits[distanceCode]);
+    }
+
+    size_t Hash(Bytes const& data, const size_t position)
+    {
+        const uint32_t value = data[position] | data[position + 1] << 8 | data[position + 2] << 16;
+        return value * 2654435761u >> (32 - HashBits);
+    }
+}
+
+Bytes Deflate(Bytes const& data)
+{
+    BitWriter bits;
+    bits.Data.reserve(data.size() / 2 + 16);
+    // A single final block with the fixed codes
+    bits.Write(1, 1);
+    bits.Write(1, 2);
+
+    // Most recent position of every hash and, per window slot, the previous position with the same hash
+    std::vector<size_t> head(size_t{ 1 } << HashBits, NoPosition);
+    std::vector<size_t> previous(WindowSize, NoPosition);
+    const auto insert = [&](const size_t position)
+    {
+        if (position + MinMatch > data.size())
+            return;
+        const auto hash = Hash(data, position);
+        previous[position % WindowSize] = head[hash];
+        head[hash] = position;
+    };
+
+    for (size_t position = 0; position < data.size();)
+    {
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        if (position + MinMatch <= data.size())
+        {
+            const auto maxLength = std::min(MaxMatch, data.size() - position);
+            auto candidate = head[Hash(data, position)];
+            for (size_t chain = 0; chain < MaxChainLength && candidate != NoPosition; ++chain)
+            {
+                if (position - candidate > WindowSize)
+                    break;
+                size_t length = 0;
+                while (length < maxLength && data[candidate + length] == data[position + length])
+                    ++length;
+                if (length > bestLength)
+                {
+                    bestLength = length;
+                    bestDistance = position - candidate;
+                    if (length == maxLength)
+                        break;
+                }
+                // Slots are reused once the window moves on, an older chain entry ends the search
+                const auto next = previous[candidate % WindowSize];
+                if (next == NoPosition || next >= candidate)
+                    break;
+                candidate = next;
+            }
+        }
+
+        if (bestLength >= MinMatch)
+        {
+            WriteMatch(bits, bestLength, bestDistance);
+            for (size_t i = 0; i < bestLength; ++i)
+                insert(position + i);
+            position += bestLength;
+        }
+        else
+        {
+            WriteSymbol(bits, data[position]);
+            insert(position);
+            ++position;
+        }
+    }
+
+    WriteSymbol(bits, 256);
+    bits.Flush();
+    return std::move(bits.Data);
+}
+
+uint32_t Crc32(Bytes const& data)
+{
+    static const auto table = []
+    {
+        std::array<uint32_t, 256> result{};
+        for (uint32_t i = 0; i < result.size(); ++i)
+        {
+            auto value = i;
+            for (int bit = 0; bit < 8; ++bit)
+                value = value & 1 ? 0xEDB88320u ^ value >> 1 : value >> 1;
+            result[i] = value;
+        }
+        return result;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (const auto byte : data)
+        crc = table[(crc ^ byte) & 0xFF] ^ crc >> 8;
+    return crc ^ 0xFFFFFFFFu;
+}
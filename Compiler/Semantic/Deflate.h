@@ -0,0 +1,10 @@
+#pragma once
+#include <cstdint>
+#include "ByteWriter.h"
+
+// Compresses the data into a raw deflate stream (RFC 1951), as zip entries with method 8 store it.
+// Repeats are found with LZ77 over a 32 KiB window and coded with the fixed Huffman tables
+[[nodiscard]] Bytes Deflate(Bytes const& data);
+
+// CRC-32 that zip archives keep for every entry
+[[nodiscard]] uint32_t Crc32(Bytes const& data);
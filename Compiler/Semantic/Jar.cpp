@@ -0,0 +1,151 @@
+#include "Jar.h"
+#include <limits>
+#include <stdexcept>
+#include "Deflate.h"
+
+namespace
+{
+    constexpr uint32_t LocalHeaderSignature = 0x04034B50;
+    constexpr uint32_t DirectoryHeaderSignature = 0x02014B50;
+    constexpr uint32_t EndOfDirectorySignature = 0x06054B50;
+    // Zip 2.0 is needed for deflate, stored entries only need 1.0
+    constexpr uint16_t DeflateVersion = 20;
+    constexpr uint16_t StoredVersion = 10;
+    constexpr uint16_t DeflateMethod = 8;
+    constexpr uint16_t StoredMethod = 0;
+    // Names are UTF-8
+    constexpr uint16_t Utf8NamesFlag = 1 << 11;
+    // 1980-01-01 00:00 in MS-DOS format, the earliest time zip can hold
+    constexpr uint16_t FixedTime = 0;
+    constexpr uint16_t FixedDate = 1 << 5 | 1;
+
+    // Zip numbers are little-endian, unlike the ones in class files
+    void WriteU2(Bytes& bytes, const uint16_t value)
+    {
+        bytes.push_back(static_cast<uint8_t>(value));
+        bytes.push_back(static_cast<uint8_t>(value >> 8));
+    }
+
+    void WriteU4(Bytes& bytes, const uint32_t value)
+    {
+        WriteU2(bytes, static_cast<uint16_t>(value));
+        WriteU2(bytes, static_cast<uint16_t>(value >> 16));
+    }
+
+    uint32_t CheckedSize(const size_t size)
+    {
+        if (size > std::numeric_limits<uint32_t>::max())
+            throw std::runtime_error{ "Jar entries over 4 GiB are not supported" };
+        return static_cast<uint32_t>(size);
+    }
+}
+
+JarEntry JarEntry::Make(std::string name, Bytes const& content, const bool deflate)
+{
+    JarEntry entry;
+    entry.Name = std::move(name);
+    entry.Crc = Crc32(content);
+    entry.Size = CheckedSize(content.size());
+    if (deflate)
+    {
+        auto deflated = Deflate(content);
+        if (deflated.size() < content.size())
+        {
+            entry.Data = std::move(deflated);
+            entry.IsDeflated = true;
+            return entry;
+        }
+    }
+    entry.Data = content;
+    return entry;
+}
+
+void JarWriter::Write(Bytes const& bytes)
+{
+    Out.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+    Offset = CheckedSize((size_t)Offset + bytes.size());
+}
+
+void JarWriter::Add(JarEntry const& entry)
+{
+    if (Directory.size() == std::numeric_limits<uint16_t>::max())
+        throw std::runtime_error{ "Jar can hold at most 65535 entries" };
+    Directory.push_back({
+        entry.Name, entry.Crc, CheckedSize(entry.Data.size()), entry.Size, entry.IsDeflated, Offset
+    });
+
+    Bytes header;
+    WriteU4(header, LocalHeaderSignature);
+    WriteU2(header, entry.IsDeflated ? DeflateVersion : StoredVersion);
+    WriteU2(header, Utf8NamesFlag);
+    WriteU2(header, entry.IsDeflated ? DeflateMethod : StoredMethod);
+    WriteU2(header, FixedTime);
+    WriteU2(header, FixedDate);
+    WriteU4(header, entry.Crc);
+    WriteU4(header, CheckedSize(entry.Data.size()));
+    WriteU4(header, entry.Size);
+    WriteU2(header, static_cast<uint16_t>(entry.Name.size()));
+    WriteU2(header, 0);
+    header.insert(header.end(), entry.Name.begin(), entry.Name.end());
+    Write(header);
+    Write(entry.Data);
+}
+
+void JarWriter::Finish()
+{
+    const auto directoryOffset = Offset;
+    for (auto const& record : Directory)
+    {
+        Bytes header;
+        WriteU4(header, DirectoryHeaderSignature);
+        WriteU2(header, DeflateVersion);
+        WriteU2(header, record.IsDeflated ? DeflateVersion : StoredVersion);
+        WriteU2(header, Utf8NamesFlag);
+        WriteU2(header, record.IsDeflated ? DeflateMethod : StoredMethod);
+        WriteU2(header, FixedTime);
+        WriteU2(header, FixedDate);
+        WriteU4(header, record.Crc);
+        WriteU4(header, record.CompressedSize);
+        WriteU4(header, record.Size);
+        WriteU2(header, static_cast<uint16_t>(record.Name.size()));
+        // Extra field, comment, disk number, internal and external attributes
+        WriteU2(header, 0);
+        WriteU2(header, 0);
+        WriteU2(header, 0);
+        WriteU2(header, 0);
+        WriteU4(header, 0);
+        WriteU4(header, record.Offset);
+        header.insert(header.end(), record.Name.begin(), record.Name.end());
+        Write(header);
+    }
+
+    Bytes end;
+    WriteU4(end, EndOfDirectorySignature);
+    // This disk and the disk with the directory
+    WriteU2(end, 0);
+    WriteU2(end, 0);
+    WriteU2(end, static_cast<uint16_t>(Directory.size()));
+    WriteU2(end, static_cast<uint16_t>(Directory.size()));
+    WriteU4(end, Offset - directoryOffset);
+    WriteU4(end, directoryOffset);
+    // Comment length
+    WriteU2(end, 0);
+    Write(end);
+    Out.flush();
+}
+
+Bytes MakeManifest(std::string_view mainClass)
+{
+    std::string mainClassLine = "Main-Class: ";
+    for (const auto c : mainClass)
+        mainClassLine += c == '/' ? '.' : c;
+
+    std::string manifest = "Manifest-Version: 1.0\r\n";
+    // A manifest line holds at most 72 bytes, the rest goes on continuation lines that start with a space
+    constexpr size_t maxLineLength = 72;
+    manifest += mainClassLine.substr(0, maxLineLength);
+    for (auto position = maxLineLength; position < mainClassLine.size(); position += maxLineLength - 1)
+        manifest += "\r\n " + mainClassLine.substr(position, maxLineLength - 1);
+    manifest += "\r\n\r\n";
+    return { manifest.begin(), manifest.end() };
+}
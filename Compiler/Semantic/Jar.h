@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ByteWriter.h"
+
+// File of a jar archive, compressed before it is written, so entries can be prepared on several threads
+struct JarEntry
+{
+    std::string Name;
+    // Content as it is stored in the archive
+    Bytes Data;
+    uint32_t Crc = 0;
+    uint32_t Size = 0;
+    bool IsDeflated = false;
+
+    // Deflates the content if asked and if that makes it smaller, otherwise stores it as is
+    [[nodiscard]] static JarEntry Make(std::string name, Bytes const& content, bool deflate);
+};
+
+// Writes a zip archive straight into the stream: each entry as it is added and the central directory in Finish.
+// Entries get a fixed timestamp, so the same classes always give the same archive
+struct JarWriter
+{
+    explicit JarWriter(std::ostream& out) : Out{ out }
+    {
+    }
+
+    void Add(JarEntry const& entry);
+
+    void Finish();
+
+private:
+    struct DirectoryRecord
+    {
+        std::string Name;
+        uint32_t Crc;
+        uint32_t CompressedSize;
+        uint32_t Size;
+        bool IsDeflated;
+        uint32_t Offset;
+    };
+
+    std::ostream& Out;
+    uint32_t Offset = 0;
+    std::vector<DirectoryRecord> Directory;
+
+    void Write(Bytes const& bytes);
+};
+
+// META-INF/MANIFEST.MF content that makes `java -jar` start the class, given as ns/Class
+[[nodiscard]] Bytes MakeManifest(std::string_view mainClass);
@@ -2,6 +2,7 @@
 #include <string>
 #include <vector>
 #include "../VisibilityModifier.h"
+#include "../Tree/Symbol.h"
 
 struct Field
 {
@@ -46,7 +47,7 @@ struct DataType
 
     bool IsUnknown{};
 
-    std::vector<std::string> ComplexType{};
+    std::vector<Symbol> ComplexType{};
 
     bool operator==(const DataType& data) const
     {
@@ -183,14 +184,14 @@ inline std::string ToString(std::vector<DataType> const& container)
 const inline DataType JAVA_OBJECT_TYPE = []
 {
     DataType type{ DataType::TypeT::Complex };
-    type.ComplexType = { "java", "lang", "Object" };
+    type.ComplexType = { Symbol::Intern("java"), Symbol::Intern("lang"), Symbol::Intern("Object") };
     return type;
 }();
 
 const inline DataType STD_STRING_TYPE = []
 {
     DataType type{ DataType::TypeT::Complex };
-    type.ComplexType = { "System", "String" };
+    type.ComplexType = { Symbol::Intern("System"), Symbol::Intern("String") };
     return type;
 }();
 
@@ -202,3 +203,20 @@ constexpr inline struct
     "<init>",
     "(Ljava/lang/String;)V"
 };
+
+// Returns the java/lang/String a System/String wraps
+constexpr inline struct
+{
+    std::string_view Name;
+    std::string_view Descriptor;
+} STD_STRING_TO_STRING_INFO{
+    "toString",
+    "()Ljava/lang/String;"
+};
+
+// Compares the type itself, DataType::operator== also accepts null for any class
+[[nodiscard]] inline bool IsStdString(DataType const& type)
+{
+    return type.AType == DataType::TypeT::Complex && type.ArrayArity == 0
+           && type.ComplexType == STD_STRING_TYPE.ComplexType;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// Calls action(i) for every i below count on up to `jobs` threads, the calling one included.
+// Threads take the next index from a shared counter. An exception stops nothing else, the one of the
+// lowest index is rethrown after all threads finish, so the reported failure does not depend on the threads
+template <typename Action>
+void ParallelFor(const size_t count, const unsigned jobs, Action const& action)
+{
+    std::vector<std::exception_ptr> failures(count);
+    std::atomic<size_t> next = 0;
+    const auto work = [&]
+    {
+        for (auto i = next++; i < count; i = next++)
+        {
+            try { action(i); }
+            catch (...) { failures[i] = std::current_exception(); }
+        }
+    };
+
+    const auto threadsCount = std::min<size_t>(std::max(jobs, 1u), count);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threadsCount; ++i) { workers.emplace_back(work); }
+    work();
+    for (auto& worker : workers) { worker.join(); }
+
+    for (auto const& failure : failures)
+    {
+        if (failure)
+            std::rethrow_exception(failure);
+    }
+}
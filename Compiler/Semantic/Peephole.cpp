@@ -0,0 +1,185 @@
+#include "Peephole.h"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    bool IsLoad(const Command command)
+    {
+        return command == Command::iload || command == Command::aload;
+    }
+
+    Command LoadOf(const Command store)
+    {
+        return store == Command::istore ? Command::iload : Command::aload;
+    }
+
+    bool IsStore(const Command command)
+    {
+        return command == Command::istore || command == Command::astore;
+    }
+
+    // Instructions some jump lands on. A pattern must not span one of them,
+    // otherwise the other path would run the rewritten code
+    std::vector<bool> JumpTargets(Assembler const& code)
+    {
+        std::vector<bool> isTarget(code.Instructions.size() + 1);
+        for (const auto& instruction : code.Instructions)
+        {
+            if (IsJump(instruction.Opcode))
+                isTarget[code.LabelPositions[instruction.Target]] = true;
+        }
+        return isTarget;
+    }
+
+    bool IsReturn(const Command command)
+    {
+        return command == Command::return_ || command == Command::ireturn || command == Command::areturn;
+    }
+
+    // Label the jump ends up at after following the gotos it lands on.
+    // Gotos that form a cycle (an empty endless loop) are left alone
+    LabelT FinalTarget(Assembler const& code, const LabelT target)
+    {
+        std::vector<bool> isVisited(code.Instructions.size());
+        auto result = target;
+        for (;;)
+        {
+            const auto position = code.LabelPositions[result];
+            if (position >= code.Instructions.size() || code.Instructions[position].Opcode != Command::goto_)
+                return result;
+            if (isVisited[position])
+                return target;
+            isVisited[position] = true;
+            result = code.Instructions[position].Target;
+        }
+    }
+
+    bool ShortenConstant(Instruction& instruction)
+    {
+        const auto value = instruction.Operand;
+        if (value >= -1 && value <= 5)
+        {
+            instruction = { (Command)((int)Command::iconst_0 + value) };
+            return true;
+        }
+        if (value >= std::numeric_limits<int8_t>::min() && value <= std::numeric_limits<int8_t>::max())
+        {
+            instruction.Opcode = Command::bipush;
+            return true;
+        }
+        return false;
+    }
+}
+
+bool ParsePeepholeRules(std::string_view rules, PeepholeOptions& options)
+{
+    options = PeepholeOptions::None();
+    while (!rules.empty())
+    {
+        const auto comma = rules.find(',');
+        const auto rule = rules.substr(0, comma);
+        rules = comma == std::string_view::npos ? std::string_view{} : rules.substr(comma + 1);
+
+        if (rule == "nops")
+            options.RemoveNops = true;
+        else if (rule == "constants")
+            options.ShortenConstants = true;
+        else if (rule == "jumps")
+            options.RemoveJumpsToNext = true;
+        else if (rule == "loads")
+            options.RemoveUnusedLoads = true;
+        else if (rule == "stores")
+            options.ForwardStores = true;
+        else if (rule == "threads")
+            options.ThreadJumps = true;
+        else
+            return false;
+    }
+    return true;
+}
+
+void RunPeephole(Assembler& code, PeepholeOptions const& options)
+{
+    auto& instructions = code.Instructions;
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        const auto isTarget = JumpTargets(code);
+        std::vector<bool> isRemoved(instructions.size());
+        // Whether instructions[i] and instructions[i + offset] always run one after another
+        const auto isFollowedBy = [&](const size_t i, const size_t offset, const Command command)
+        {
+            for (size_t k = 1; k <= offset; ++k)
+            {
+                if (i + k >= instructions.size() || isTarget[i + k])
+                    return false;
+            }
+            return instructions[i + offset].Opcode == command;
+        };
+
+        for (size_t i = 0; i < instructions.size(); ++i)
+        {
+            auto& instruction = instructions[i];
+            if (options.RemoveNops && instruction.Opcode == Command::nop)
+            {
+                isRemoved[i] = true;
+            }
+            else if (options.ShortenConstants && instruction.Opcode == Command::sipush)
+            {
+                changed |= ShortenConstant(instruction);
+            }
+            else if (options.RemoveJumpsToNext && instruction.Opcode == Command::goto_ &&
+                     code.LabelPositions[instruction.Target] == i + 1)
+            {
+                isRemoved[i] = true;
+            }
+            else if (options.ThreadJumps && instruction.Opcode == Command::goto_ &&
+                     code.LabelPositions[instruction.Target] < instructions.size() &&
+                     IsReturn(instructions[code.LabelPositions[instruction.Target]].Opcode))
+            {
+                instruction = { instructions[code.LabelPositions[instruction.Target]].Opcode };
+                changed = true;
+            }
+            else if (options.ThreadJumps && IsJump(instruction.Opcode) && instruction.Opcode != Command::goto_ &&
+                     isFollowedBy(i, 1, Command::goto_) && code.LabelPositions[instruction.Target] == i + 2)
+            {
+                instruction.Opcode = InvertCondition(instruction.Opcode);
+                instruction.Target = instructions[i + 1].Target;
+                isRemoved[i + 1] = true;
+                ++i;
+            }
+            else if (options.ThreadJumps && IsJump(instruction.Opcode) &&
+                     code.LabelPositions[FinalTarget(code, instruction.Target)] !=
+                     code.LabelPositions[instruction.Target])
+            {
+                instruction.Target = FinalTarget(code, instruction.Target);
+                changed = true;
+            }
+            else if (options.RemoveUnusedLoads && IsLoad(instruction.Opcode) && isFollowedBy(i, 1, Command::pop))
+            {
+                isRemoved[i] = isRemoved[i + 1] = true;
+                ++i;
+            }
+            else if (options.ForwardStores && IsStore(instruction.Opcode) &&
+                     isFollowedBy(i, 1, LoadOf(instruction.Opcode)) &&
+                     instructions[i + 1].Operand == instruction.Operand &&
+                     !(options.RemoveUnusedLoads && isFollowedBy(i, 2, Command::pop)))
+            {
+                instructions[i + 1] = instruction;
+                instruction = { Command::dup };
+                changed = true;
+                ++i;
+            }
+        }
+
+        if (std::find(isRemoved.begin(), isRemoved.end(), true) != isRemoved.end())
+        {
+            code.Remove(isRemoved);
+            changed = true;
+        }
+        // Gotos that every jump now bypasses have no stack map frame and must go
+        if (options.ThreadJumps && changed)
+            code.RemoveUnreachable();
+    }
+}
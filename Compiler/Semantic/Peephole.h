@@ -0,0 +1,34 @@
+#pragma once
+#include <string_view>
+#include "Assembler.h"
+
+// Rules of the peephole pass, each can be switched off on its own
+struct PeepholeOptions
+{
+    // nop the code generator leaves as a jump target after if/while/for
+    bool RemoveNops = true;
+    // sipush of a value that fits iconst_<n> or bipush
+    bool ShortenConstants = true;
+    // goto to the instruction right after it
+    bool RemoveJumpsToNext = true;
+    // iload/aload whose value is popped right away, left by expression statements like ++i;
+    bool RemoveUnusedLoads = true;
+    // istore x; iload x becomes dup; istore x
+    bool ForwardStores = true;
+    // jump to a goto goes straight to its target, goto to a return becomes the return,
+    // conditional jump over a goto becomes the inverted jump to the goto's target
+    bool ThreadJumps = true;
+
+    [[nodiscard]] static PeepholeOptions None()
+    {
+        return { false, false, false, false, false, false };
+    }
+};
+
+// Enables only the rules named in the comma separated list: nops, constants, jumps, loads, stores, threads.
+// Returns false on an unknown name
+[[nodiscard]] bool ParsePeepholeRules(std::string_view rules, PeepholeOptions& options);
+
+// Rewrites the instructions until no rule applies. Labels bound to removed instructions
+// move to the next kept one, jumps into the middle of a pattern prevent the rewrite
+void RunPeephole(Assembler& code, PeepholeOptions const& options);
@@ -0,0 +1,319 @@
+// Generated by embed_runtime.py from the classes in "Runtime Library/Binary", do not edit
+#include "RuntimeLibrary.h"
+
+namespace
+{
+    constexpr unsigned char Class0[] = {
+        0xCA, 0xFE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x39, 0x00, 0x74, 0x0A, 0x00, 0x02, 0x00, 0x03, 0x07,
+        0x00, 0x04, 0x0C, 0x00, 0x05, 0x00, 0x06, 0x01, 0x00, 0x10, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C,
+        0x61, 0x6E, 0x67, 0x2F, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x01, 0x00, 0x06, 0x3C, 0x69, 0x6E,
+        0x69, 0x74, 0x3E, 0x01, 0x00, 0x03, 0x28, 0x29, 0x56, 0x07, 0x00, 0x08, 0x01, 0x00, 0x11, 0x6A,
+        0x61, 0x76, 0x61, 0x2F, 0x75, 0x74, 0x69, 0x6C, 0x2F, 0x53, 0x63, 0x61, 0x6E, 0x6E, 0x65, 0x72,
+        0x09, 0x00, 0x0A, 0x00, 0x0B, 0x07, 0x00, 0x0C, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x01, 0x00, 0x10,
+        0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D,
+        0x01, 0x00, 0x02, 0x69, 0x6E, 0x01, 0x00, 0x15, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x69, 0x6F,
+        0x2F, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x3B, 0x0A, 0x00, 0x07,
+        0x00, 0x10, 0x0C, 0x00, 0x05, 0x00, 0x11, 0x01, 0x00, 0x18, 0x28, 0x4C, 0x6A, 0x61, 0x76, 0x61,
+        0x2F, 0x69, 0x6F, 0x2F, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x3B,
+        0x29, 0x56, 0x09, 0x00, 0x13, 0x00, 0x14, 0x07, 0x00, 0x15, 0x0C, 0x00, 0x0D, 0x00, 0x16, 0x01,
+        0x00, 0x0E, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x43, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65,
+        0x01, 0x00, 0x13, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x75, 0x74, 0x69, 0x6C, 0x2F, 0x53, 0x63,
+        0x61, 0x6E, 0x6E, 0x65, 0x72, 0x3B, 0x09, 0x00, 0x0A, 0x00, 0x18, 0x0C, 0x00, 0x19, 0x00, 0x1A,
+        0x01, 0x00, 0x03, 0x6F, 0x75, 0x74, 0x01, 0x00, 0x15, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x69,
+        0x6F, 0x2F, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x3B, 0x0A, 0x00,
+        0x1C, 0x00, 0x1D, 0x07, 0x00, 0x1E, 0x0C, 0x00, 0x1F, 0x00, 0x20, 0x01, 0x00, 0x13, 0x6A, 0x61,
+        0x76, 0x61, 0x2F, 0x69, 0x6F, 0x2F, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61,
+        0x6D, 0x01, 0x00, 0x07, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x6C, 0x6E, 0x01, 0x00, 0x04, 0x28, 0x49,
+        0x29, 0x56, 0x0A, 0x00, 0x1C, 0x00, 0x22, 0x0C, 0x00, 0x1F, 0x00, 0x23, 0x01, 0x00, 0x04, 0x28,
+        0x46, 0x29, 0x56, 0x0A, 0x00, 0x1C, 0x00, 0x25, 0x0C, 0x00, 0x1F, 0x00, 0x26, 0x01, 0x00, 0x04,
+        0x28, 0x43, 0x29, 0x56, 0x09, 0x00, 0x28, 0x00, 0x29, 0x07, 0x00, 0x2A, 0x0C, 0x00, 0x2B, 0x00,
+        0x2C, 0x01, 0x00, 0x0D, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E,
+        0x67, 0x01, 0x00, 0x06, 0x73, 0x74, 0x72, 0x56, 0x61, 0x6C, 0x01, 0x00, 0x12, 0x4C, 0x6A, 0x61,
+        0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x0A,
+        0x00, 0x1C, 0x00, 0x2E, 0x0C, 0x00, 0x1F, 0x00, 0x2F, 0x01, 0x00, 0x15, 0x28, 0x4C, 0x6A, 0x61,
+        0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x29,
+        0x56, 0x0A, 0x00, 0x1C, 0x00, 0x31, 0x0C, 0x00, 0x1F, 0x00, 0x32, 0x01, 0x00, 0x04, 0x28, 0x5A,
+        0x29, 0x56, 0x0A, 0x00, 0x07, 0x00, 0x34, 0x0C, 0x00, 0x35, 0x00, 0x36, 0x01, 0x00, 0x07, 0x6E,
+        0x65, 0x78, 0x74, 0x49, 0x6E, 0x74, 0x01, 0x00, 0x03, 0x28, 0x29, 0x49, 0x0A, 0x00, 0x07, 0x00,
+        0x38, 0x0C, 0x00, 0x39, 0x00, 0x3A, 0x01, 0x00, 0x09, 0x6E, 0x65, 0x78, 0x74, 0x46, 0x6C, 0x6F,
+        0x61, 0x74, 0x01, 0x00, 0x03, 0x28, 0x29, 0x46, 0x0A, 0x00, 0x3C, 0x00, 0x3D, 0x07, 0x00, 0x3E,
+        0x0C, 0x00, 0x3F, 0x00, 0x36, 0x01, 0x00, 0x13, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x69, 0x6F, 0x2F,
+        0x49, 0x6E, 0x70, 0x75, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x01, 0x00, 0x04, 0x72, 0x65,
+        0x61, 0x64, 0x07, 0x00, 0x41, 0x01, 0x00, 0x13, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x69, 0x6F, 0x2F,
+        0x49, 0x4F, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x00, 0x40, 0x00, 0x43,
+        0x0C, 0x00, 0x44, 0x00, 0x06, 0x01, 0x00, 0x0F, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x74, 0x61,
+        0x63, 0x6B, 0x54, 0x72, 0x61, 0x63, 0x65, 0x0A, 0x00, 0x07, 0x00, 0x46, 0x0C, 0x00, 0x47, 0x00,
+        0x48, 0x01, 0x00, 0x04, 0x6E, 0x65, 0x78, 0x74, 0x01, 0x00, 0x14, 0x28, 0x29, 0x4C, 0x6A, 0x61,
+        0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x0A,
+        0x00, 0x28, 0x00, 0x4A, 0x0C, 0x00, 0x05, 0x00, 0x2F, 0x0A, 0x00, 0x07, 0x00, 0x4C, 0x0C, 0x00,
+        0x4D, 0x00, 0x4E, 0x01, 0x00, 0x0B, 0x6E, 0x65, 0x78, 0x74, 0x42, 0x6F, 0x6F, 0x6C, 0x65, 0x61,
+        0x6E, 0x01, 0x00, 0x03, 0x28, 0x29, 0x5A, 0x0A, 0x00, 0x1C, 0x00, 0x50, 0x0C, 0x00, 0x51, 0x00,
+        0x20, 0x01, 0x00, 0x05, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x0A, 0x00, 0x1C, 0x00, 0x53, 0x0C, 0x00,
+        0x51, 0x00, 0x23, 0x0A, 0x00, 0x1C, 0x00, 0x55, 0x0C, 0x00, 0x51, 0x00, 0x26, 0x0A, 0x00, 0x1C,
+        0x00, 0x57, 0x0C, 0x00, 0x51, 0x00, 0x2F, 0x0A, 0x00, 0x1C, 0x00, 0x59, 0x0C, 0x00, 0x51, 0x00,
+        0x32, 0x01, 0x00, 0x04, 0x43, 0x6F, 0x64, 0x65, 0x01, 0x00, 0x0F, 0x4C, 0x69, 0x6E, 0x65, 0x4E,
+        0x75, 0x6D, 0x62, 0x65, 0x72, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x01, 0x00, 0x12, 0x4C, 0x6F, 0x63,
+        0x61, 0x6C, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x01,
+        0x00, 0x04, 0x74, 0x68, 0x69, 0x73, 0x01, 0x00, 0x10, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D,
+        0x2F, 0x43, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x3B, 0x01, 0x00, 0x09, 0x57, 0x72, 0x69, 0x74,
+        0x65, 0x4C, 0x69, 0x6E, 0x65, 0x01, 0x00, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x01, 0x00, 0x01,
+        0x49, 0x01, 0x00, 0x01, 0x46, 0x01, 0x00, 0x01, 0x43, 0x01, 0x00, 0x12, 0x28, 0x4C, 0x53, 0x79,
+        0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x29, 0x56, 0x01, 0x00,
+        0x0F, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B,
+        0x01, 0x00, 0x01, 0x5A, 0x01, 0x00, 0x07, 0x52, 0x65, 0x61, 0x64, 0x49, 0x6E, 0x74, 0x01, 0x00,
+        0x09, 0x52, 0x65, 0x61, 0x64, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x01, 0x00, 0x08, 0x52, 0x65, 0x61,
+        0x64, 0x43, 0x68, 0x61, 0x72, 0x01, 0x00, 0x03, 0x28, 0x29, 0x43, 0x01, 0x00, 0x01, 0x65, 0x01,
+        0x00, 0x15, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x69, 0x6F, 0x2F, 0x49, 0x4F, 0x45, 0x78, 0x63,
+        0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3B, 0x01, 0x00, 0x0D, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x4D,
+        0x61, 0x70, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x01, 0x00, 0x0A, 0x52, 0x65, 0x61, 0x64, 0x53, 0x74,
+        0x72, 0x69, 0x6E, 0x67, 0x01, 0x00, 0x11, 0x28, 0x29, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D,
+        0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x01, 0x00, 0x08, 0x52, 0x65, 0x61, 0x64, 0x42,
+        0x6F, 0x6F, 0x6C, 0x01, 0x00, 0x05, 0x57, 0x72, 0x69, 0x74, 0x65, 0x01, 0x00, 0x0A, 0x53, 0x6F,
+        0x75, 0x72, 0x63, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x01, 0x00, 0x0C, 0x43, 0x6F, 0x6E, 0x73, 0x6F,
+        0x6C, 0x65, 0x2E, 0x6A, 0x61, 0x76, 0x61, 0x00, 0x21, 0x00, 0x13, 0x00, 0x02, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x05, 0x00,
+        0x06, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x13, 0x2A, 0xB7, 0x00, 0x01, 0x2A, 0xBB, 0x00, 0x07, 0x59, 0xB2, 0x00, 0x09, 0xB7, 0x00, 0x0F,
+        0xB5, 0x00, 0x12, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x07, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x13, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5F, 0x00, 0x20,
+        0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08,
+        0xB2, 0x00, 0x17, 0x1B, 0xB6, 0x00, 0x1B, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00,
+        0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x5C, 0x00, 0x00,
+        0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0x00, 0x60, 0x00, 0x61, 0x00, 0x01, 0x00, 0x01, 0x00, 0x5F, 0x00, 0x23, 0x00, 0x01,
+        0x00, 0x5A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0xB2, 0x00,
+        0x17, 0x23, 0xB6, 0x00, 0x21, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x0A,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x10, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x16,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x00, 0x60, 0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x5F, 0x00, 0x26, 0x00, 0x01, 0x00, 0x5A,
+        0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0xB2, 0x00, 0x17, 0x1B,
+        0xB6, 0x00, 0x24, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0x13, 0x00, 0x07, 0x00, 0x14, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60,
+        0x00, 0x63, 0x00, 0x01, 0x00, 0x01, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00,
+        0x00, 0x43, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0xB2, 0x00, 0x17, 0x2B, 0xB4, 0x00,
+        0x27, 0xB6, 0x00, 0x2D, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x0A, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x16, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
+        0x60, 0x00, 0x65, 0x00, 0x01, 0x00, 0x01, 0x00, 0x5F, 0x00, 0x32, 0x00, 0x01, 0x00, 0x5A, 0x00,
+        0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0xB2, 0x00, 0x17, 0x1B, 0xB6,
+        0x00, 0x30, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x1B, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00,
+        0x66, 0x00, 0x01, 0x00, 0x01, 0x00, 0x67, 0x00, 0x36, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00,
+        0x32, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x2A, 0xB4, 0x00, 0x12, 0xB6, 0x00, 0x33,
+        0xAC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x20, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00,
+        0x5E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x68, 0x00, 0x3A, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00,
+        0x32, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x2A, 0xB4, 0x00, 0x12, 0xB6, 0x00, 0x37,
+        0xAE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x24, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00,
+        0x5E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00,
+        0x85, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x03, 0x3C, 0xB2, 0x00, 0x09, 0xB6, 0x00,
+        0x3B, 0x92, 0x3C, 0xA7, 0x00, 0x08, 0x4D, 0x2C, 0xB6, 0x00, 0x42, 0x1B, 0xAC, 0x00, 0x01, 0x00,
+        0x02, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x40, 0x00, 0x03, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x1A, 0x00,
+        0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x02, 0x00, 0x2A, 0x00, 0x0A, 0x00, 0x2D, 0x00, 0x0D, 0x00,
+        0x2B, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x12, 0x00, 0x2E, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x20, 0x00,
+        0x03, 0x00, 0x0E, 0x00, 0x04, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00,
+        0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x12, 0x00, 0x60, 0x00, 0x63, 0x00, 0x01, 0x00,
+        0x6D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0xFF, 0x00, 0x0D, 0x00, 0x02, 0x07, 0x00, 0x13, 0x01,
+        0x00, 0x01, 0x07, 0x00, 0x40, 0x04, 0x00, 0x01, 0x00, 0x6E, 0x00, 0x6F, 0x00, 0x01, 0x00, 0x5A,
+        0x00, 0x00, 0x00, 0x39, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xBB, 0x00, 0x28, 0x59,
+        0x2A, 0xB4, 0x00, 0x12, 0xB6, 0x00, 0x45, 0xB7, 0x00, 0x49, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x00,
+        0x5B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x5C, 0x00, 0x00, 0x00,
+        0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x01, 0x00,
+        0x70, 0x00, 0x4E, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x00, 0x00, 0x08, 0x2A, 0xB4, 0x00, 0x12, 0xB6, 0x00, 0x4B, 0xAC, 0x00, 0x00, 0x00, 0x02, 0x00,
+        0x5B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x5C, 0x00, 0x00, 0x00,
+        0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x01, 0x00,
+        0x71, 0x00, 0x20, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x08, 0xB2, 0x00, 0x17, 0x1B, 0xB6, 0x00, 0x4F, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00,
+        0x5B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x07, 0x00, 0x3C, 0x00,
+        0x5C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x61, 0x00, 0x01, 0x00, 0x01, 0x00, 0x71, 0x00,
+        0x23, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+        0x08, 0xB2, 0x00, 0x17, 0x23, 0xB6, 0x00, 0x52, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00,
+        0x00, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0x00, 0x40, 0x00, 0x5C, 0x00,
+        0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x71, 0x00, 0x26, 0x00,
+        0x01, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0xB2,
+        0x00, 0x17, 0x1B, 0xB6, 0x00, 0x54, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00,
+        0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x43, 0x00, 0x07, 0x00, 0x44, 0x00, 0x5C, 0x00, 0x00, 0x00,
+        0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0x00, 0x60, 0x00, 0x63, 0x00, 0x01, 0x00, 0x01, 0x00, 0x71, 0x00, 0x64, 0x00, 0x01, 0x00,
+        0x5A, 0x00, 0x00, 0x00, 0x43, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0xB2, 0x00, 0x17,
+        0x2B, 0xB4, 0x00, 0x27, 0xB6, 0x00, 0x56, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00,
+        0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x0A, 0x00, 0x48, 0x00, 0x5C, 0x00, 0x00,
+        0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0B, 0x00, 0x60, 0x00, 0x65, 0x00, 0x01, 0x00, 0x01, 0x00, 0x71, 0x00, 0x32, 0x00, 0x01,
+        0x00, 0x5A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0xB2, 0x00,
+        0x17, 0x1B, 0xB6, 0x00, 0x58, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x0A,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x07, 0x00, 0x4C, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x16,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x00, 0x60, 0x00, 0x66, 0x00, 0x01, 0x00, 0x01, 0x00, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x73,
+    };
+
+    constexpr unsigned char Class1[] = {
+        0xCA, 0xFE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x39, 0x00, 0x68, 0x08, 0x00, 0x02, 0x01, 0x00, 0x00,
+        0x0A, 0x00, 0x04, 0x00, 0x05, 0x07, 0x00, 0x06, 0x0C, 0x00, 0x07, 0x00, 0x08, 0x01, 0x00, 0x0D,
+        0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x01, 0x00, 0x06,
+        0x3C, 0x69, 0x6E, 0x69, 0x74, 0x3E, 0x01, 0x00, 0x15, 0x28, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F,
+        0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x29, 0x56, 0x0A, 0x00,
+        0x0A, 0x00, 0x0B, 0x07, 0x00, 0x0C, 0x0C, 0x00, 0x07, 0x00, 0x0D, 0x01, 0x00, 0x10, 0x6A, 0x61,
+        0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x01, 0x00,
+        0x03, 0x28, 0x29, 0x56, 0x09, 0x00, 0x04, 0x00, 0x0F, 0x0C, 0x00, 0x10, 0x00, 0x11, 0x01, 0x00,
+        0x06, 0x73, 0x74, 0x72, 0x56, 0x61, 0x6C, 0x01, 0x00, 0x12, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F,
+        0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x0A, 0x00, 0x13, 0x00,
+        0x14, 0x07, 0x00, 0x15, 0x0C, 0x00, 0x16, 0x00, 0x17, 0x01, 0x00, 0x10, 0x6A, 0x61, 0x76, 0x61,
+        0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x01, 0x00, 0x06, 0x6C,
+        0x65, 0x6E, 0x67, 0x74, 0x68, 0x01, 0x00, 0x03, 0x28, 0x29, 0x49, 0x09, 0x00, 0x04, 0x00, 0x19,
+        0x0C, 0x00, 0x1A, 0x00, 0x1B, 0x01, 0x00, 0x06, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x01, 0x00,
+        0x01, 0x49, 0x12, 0x00, 0x00, 0x00, 0x1D, 0x0C, 0x00, 0x1E, 0x00, 0x1F, 0x01, 0x00, 0x17, 0x6D,
+        0x61, 0x6B, 0x65, 0x43, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x57, 0x69, 0x74, 0x68, 0x43, 0x6F, 0x6E,
+        0x73, 0x74, 0x61, 0x6E, 0x74, 0x73, 0x01, 0x00, 0x38, 0x28, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F,
+        0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x4C, 0x6A, 0x61, 0x76,
+        0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x29, 0x4C,
+        0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67,
+        0x3B, 0x0A, 0x00, 0x13, 0x00, 0x21, 0x0C, 0x00, 0x22, 0x00, 0x23, 0x01, 0x00, 0x06, 0x65, 0x71,
+        0x75, 0x61, 0x6C, 0x73, 0x01, 0x00, 0x15, 0x28, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61,
+        0x6E, 0x67, 0x2F, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3B, 0x29, 0x5A, 0x0A, 0x00, 0x04, 0x00,
+        0x25, 0x0C, 0x00, 0x26, 0x00, 0x27, 0x01, 0x00, 0x10, 0x5F, 0x5F, 0x6F, 0x70, 0x65, 0x72, 0x61,
+        0x74, 0x6F, 0x72, 0x5F, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x01, 0x00, 0x21, 0x28, 0x4C, 0x53, 0x79,
+        0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x4C, 0x53, 0x79, 0x73,
+        0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x29, 0x5A, 0x0A, 0x00, 0x13,
+        0x00, 0x29, 0x0C, 0x00, 0x2A, 0x00, 0x2B, 0x01, 0x00, 0x06, 0x63, 0x68, 0x61, 0x72, 0x41, 0x74,
+        0x01, 0x00, 0x04, 0x28, 0x49, 0x29, 0x43, 0x0A, 0x00, 0x13, 0x00, 0x2D, 0x0C, 0x00, 0x2E, 0x00,
+        0x2F, 0x01, 0x00, 0x09, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x01, 0x00, 0x15,
+        0x28, 0x49, 0x29, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74,
+        0x72, 0x69, 0x6E, 0x67, 0x3B, 0x0A, 0x00, 0x13, 0x00, 0x31, 0x0C, 0x00, 0x2E, 0x00, 0x32, 0x01,
+        0x00, 0x16, 0x28, 0x49, 0x49, 0x29, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67,
+        0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x0A, 0x00, 0x13, 0x00, 0x34, 0x0C, 0x00, 0x35,
+        0x00, 0x36, 0x01, 0x00, 0x07, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x01, 0x00, 0x04, 0x28,
+        0x49, 0x29, 0x49, 0x0A, 0x00, 0x13, 0x00, 0x38, 0x0C, 0x00, 0x35, 0x00, 0x39, 0x01, 0x00, 0x15,
+        0x28, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69,
+        0x6E, 0x67, 0x3B, 0x29, 0x49, 0x01, 0x00, 0x04, 0x43, 0x6F, 0x64, 0x65, 0x01, 0x00, 0x0F, 0x4C,
+        0x69, 0x6E, 0x65, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x01, 0x00,
+        0x12, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x54, 0x61,
+        0x62, 0x6C, 0x65, 0x01, 0x00, 0x04, 0x74, 0x68, 0x69, 0x73, 0x01, 0x00, 0x0F, 0x4C, 0x53, 0x79,
+        0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x01, 0x00, 0x01, 0x73,
+        0x01, 0x00, 0x0F, 0x5F, 0x5F, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x5F, 0x70, 0x6C,
+        0x75, 0x73, 0x01, 0x00, 0x2F, 0x28, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74,
+        0x72, 0x69, 0x6E, 0x67, 0x3B, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72,
+        0x69, 0x6E, 0x67, 0x3B, 0x29, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72,
+        0x69, 0x6E, 0x67, 0x3B, 0x01, 0x00, 0x03, 0x6C, 0x68, 0x73, 0x01, 0x00, 0x03, 0x72, 0x68, 0x73,
+        0x01, 0x00, 0x14, 0x5F, 0x5F, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x5F, 0x6E, 0x6F,
+        0x74, 0x5F, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x01, 0x00, 0x0D, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x4D,
+        0x61, 0x70, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x01, 0x00, 0x06, 0x43, 0x68, 0x61, 0x72, 0x41, 0x74,
+        0x01, 0x00, 0x05, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x01, 0x00, 0x06, 0x45, 0x71, 0x75, 0x61, 0x6C,
+        0x73, 0x01, 0x00, 0x12, 0x28, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72,
+        0x69, 0x6E, 0x67, 0x3B, 0x29, 0x5A, 0x01, 0x00, 0x05, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x01, 0x00,
+        0x09, 0x53, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x01, 0x00, 0x12, 0x28, 0x49, 0x29,
+        0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x01,
+        0x00, 0x0A, 0x73, 0x74, 0x61, 0x72, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x01, 0x00, 0x13, 0x28,
+        0x49, 0x49, 0x29, 0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E,
+        0x67, 0x3B, 0x01, 0x00, 0x07, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x01, 0x00, 0x04, 0x28,
+        0x43, 0x29, 0x49, 0x01, 0x00, 0x02, 0x63, 0x68, 0x01, 0x00, 0x01, 0x43, 0x01, 0x00, 0x12, 0x28,
+        0x4C, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x29,
+        0x49, 0x01, 0x00, 0x03, 0x73, 0x74, 0x72, 0x01, 0x00, 0x0A, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65,
+        0x46, 0x69, 0x6C, 0x65, 0x01, 0x00, 0x0B, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x6A, 0x61,
+        0x76, 0x61, 0x01, 0x00, 0x10, 0x42, 0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x4D, 0x65,
+        0x74, 0x68, 0x6F, 0x64, 0x73, 0x0F, 0x06, 0x00, 0x59, 0x0A, 0x00, 0x5A, 0x00, 0x5B, 0x07, 0x00,
+        0x5C, 0x0C, 0x00, 0x1E, 0x00, 0x5D, 0x01, 0x00, 0x24, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61,
+        0x6E, 0x67, 0x2F, 0x69, 0x6E, 0x76, 0x6F, 0x6B, 0x65, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67,
+        0x43, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x46, 0x61, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x01, 0x00, 0x98,
+        0x28, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x69, 0x6E, 0x76, 0x6F,
+        0x6B, 0x65, 0x2F, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x73,
+        0x24, 0x4C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x3B, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61,
+        0x6E, 0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F,
+        0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x69, 0x6E, 0x76, 0x6F, 0x6B, 0x65, 0x2F, 0x4D, 0x65, 0x74, 0x68,
+        0x6F, 0x64, 0x54, 0x79, 0x70, 0x65, 0x3B, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E,
+        0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x5B, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F,
+        0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3B, 0x29, 0x4C, 0x6A, 0x61,
+        0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x69, 0x6E, 0x76, 0x6F, 0x6B, 0x65, 0x2F, 0x43,
+        0x61, 0x6C, 0x6C, 0x53, 0x69, 0x74, 0x65, 0x3B, 0x08, 0x00, 0x5F, 0x01, 0x00, 0x02, 0x01, 0x01,
+        0x01, 0x00, 0x0C, 0x49, 0x6E, 0x6E, 0x65, 0x72, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x65, 0x73, 0x07,
+        0x00, 0x62, 0x01, 0x00, 0x25, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x69,
+        0x6E, 0x76, 0x6F, 0x6B, 0x65, 0x2F, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x48, 0x61, 0x6E, 0x64,
+        0x6C, 0x65, 0x73, 0x24, 0x4C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x07, 0x00, 0x64, 0x01, 0x00, 0x1E,
+        0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E, 0x67, 0x2F, 0x69, 0x6E, 0x76, 0x6F, 0x6B, 0x65,
+        0x2F, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x73, 0x01, 0x00,
+        0x06, 0x4C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x01, 0x00, 0x08, 0x74, 0x6F, 0x53, 0x74, 0x72, 0x69,
+        0x6E, 0x67, 0x01, 0x00, 0x14, 0x28, 0x29, 0x4C, 0x6A, 0x61, 0x76, 0x61, 0x2F, 0x6C, 0x61, 0x6E,
+        0x67, 0x2F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3B, 0x00, 0x21, 0x00, 0x04, 0x00, 0x0A, 0x00,
+        0x00, 0x00, 0x02, 0x00, 0x11, 0x00, 0x1A, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00,
+        0x11, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x3A, 0x00,
+        0x00, 0x00, 0x35, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x2A, 0x12, 0x01, 0xB7, 0x00,
+        0x03, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x00,
+        0x00, 0x08, 0x00, 0x06, 0x00, 0x09, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x07, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x01,
+        0x00, 0x3A, 0x00, 0x00, 0x00, 0x52, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x2A, 0xB7,
+        0x00, 0x09, 0x2A, 0x2B, 0xB5, 0x00, 0x0E, 0x2A, 0x2B, 0xB6, 0x00, 0x12, 0xB5, 0x00, 0x18, 0xB1,
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B,
+        0x00, 0x04, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x00,
+        0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x12, 0x00, 0x3F, 0x00, 0x11, 0x00, 0x01, 0x00, 0x09, 0x00, 0x40, 0x00, 0x41, 0x00, 0x01,
+        0x00, 0x3A, 0x00, 0x00, 0x00, 0x49, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0xBB, 0x00,
+        0x04, 0x59, 0x2A, 0xB4, 0x00, 0x0E, 0x2B, 0xB4, 0x00, 0x0E, 0xBA, 0x00, 0x1C, 0x00, 0x00, 0xB7,
+        0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00,
+        0x00, 0x00, 0x11, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00,
+        0x42, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x43, 0x00, 0x3E, 0x00, 0x01, 0x00,
+        0x09, 0x00, 0x26, 0x00, 0x27, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x0C, 0x2A, 0xB4, 0x00, 0x0E, 0x2B, 0xB4, 0x00, 0x0E, 0xB6, 0x00, 0x20,
+        0xAC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x15, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x42, 0x00,
+        0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x43, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x09, 0x00,
+        0x44, 0x00, 0x27, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x02, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x0E, 0x2A, 0x2B, 0xB8, 0x00, 0x24, 0x9A, 0x00, 0x07, 0x04, 0xA7, 0x00, 0x04, 0x03,
+        0xAC, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x19, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x42, 0x00,
+        0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x43, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x45, 0x00,
+        0x00, 0x00, 0x05, 0x00, 0x02, 0x0C, 0x40, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x2B, 0x00, 0x01,
+        0x00, 0x3A, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x2A, 0xB4,
+        0x00, 0x0E, 0x1B, 0xB6, 0x00, 0x28, 0xAC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00,
+        0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x09, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x47, 0x00,
+        0x1B, 0x00, 0x01, 0x00, 0x01, 0x00, 0x48, 0x00, 0x49, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00,
+        0x40, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x2A, 0xB4, 0x00, 0x0E, 0x2B, 0xB4, 0x00,
+        0x0E, 0xB6, 0x00, 0x20, 0xAC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00,
+        0x0C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x4A, 0x00, 0x3E, 0x00,
+        0x01, 0x00, 0x01, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x44, 0x00,
+        0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0xBB, 0x00, 0x04, 0x59, 0x2A, 0xB4, 0x00, 0x0E, 0x1B,
+        0xB6, 0x00, 0x2C, 0xB7, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00,
+        0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x10, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x4D, 0x00,
+        0x1B, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00,
+        0x51, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0xBB, 0x00, 0x04, 0x59, 0x2A, 0xB4, 0x00,
+        0x0E, 0x1B, 0x1B, 0x1C, 0x60, 0xB6, 0x00, 0x30, 0xB7, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x02,
+        0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x3C, 0x00, 0x00,
+        0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x13, 0x00, 0x4D, 0x00, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x16, 0x00, 0x1B,
+        0x00, 0x02, 0x00, 0x01, 0x00, 0x4F, 0x00, 0x50, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x3D,
+        0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x2A, 0xB4, 0x00, 0x0E, 0x1B, 0xB6, 0x00, 0x33,
+        0xAC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x2D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x3D, 0x00,
+        0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x51, 0x00, 0x52, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x4F, 0x00, 0x53, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x0C, 0x2A, 0xB4, 0x00, 0x0E, 0x2B, 0xB4, 0x00, 0x0E, 0xB6, 0x00, 0x37, 0xAC, 0x00,
+        0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00,
+        0x3C, 0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x3D, 0x00, 0x3E, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x54, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x01, 0x00, 0x66, 0x00,
+        0x67, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x05, 0x2A, 0xB4, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x06,
+        0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x05, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02,
+        0x00, 0x56, 0x00, 0x57, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x58, 0x00, 0x01, 0x00, 0x5E,
+        0x00, 0x60, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x19,
+    };
+
+}
+
+const std::vector<RuntimeClass>& RuntimeClasses()
+{
+    static const std::vector<RuntimeClass> classes{
+        { "System/Console.class", Class0, sizeof Class0 },
+        { "System/String.class", Class1, sizeof Class1 },
+    };
+    return classes;
+}
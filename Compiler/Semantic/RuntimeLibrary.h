@@ -0,0 +1,16 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+// Compiled class of the System runtime library, built into the compiler so it can go into a jar
+struct RuntimeClass
+{
+    // Path inside the jar, like System/String.class
+    std::string_view Name;
+    const unsigned char* Data;
+    size_t Size;
+};
+
+// Generated by embed_runtime.py
+[[nodiscard]] const std::vector<RuntimeClass>& RuntimeClasses();
@@ -1,4 +1,7 @@
 #include "Semantic.h"
+#include <memory>
+#include <stdexcept>
+#include "Parallel.h"
 
 NamespaceDeclNode* Semantic::CreateSystemNamespace() const
 {
@@ -6,7 +9,7 @@ NamespaceDeclNode* Semantic::CreateSystemNamespace() const
 
     auto* systemMembers = new NamespaceMembersNode();
     for (auto* class_ : classes) { systemMembers->Add(class_); }
-    auto* systemNamespace = new NamespaceDeclNode("System", systemMembers);
+    auto* systemNamespace = new NamespaceDeclNode(Symbol::Intern("System"), systemMembers);
     for (auto* class_ : classes)
     {
         class_->Namespace = systemNamespace;
@@ -23,7 +26,7 @@ ClassDeclNode* Semantic::CreateConsoleClass()
 
     [[maybe_unused]] auto* readIntMethod = [&]
     {
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "ReadInt",
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("ReadInt"),
                                           MethodArguments::MakeEmpty(), nullptr);
         method->AReturnType = DataType::IntType;
         method->AnalyzeArguments();
@@ -32,10 +35,10 @@ ClassDeclNode* Semantic::CreateConsoleClass()
     }();
     [[maybe_unused]] auto* writeLineIntMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "WriteLine", args, nullptr);
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("WriteLine"), args, nullptr);
         method->AReturnType = DataType::VoidType;
         method->AnalyzeArguments();
         consoleMethods.push_back(method);
@@ -44,10 +47,10 @@ ClassDeclNode* Semantic::CreateConsoleClass()
 
     [[maybe_unused]] auto* writeIntMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "Write", args, nullptr);
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("Write"), args, nullptr);
         method->AReturnType = DataType::VoidType;
         method->AnalyzeArguments();
         consoleMethods.push_back(method);
@@ -56,10 +59,10 @@ ClassDeclNode* Semantic::CreateConsoleClass()
 
     [[maybe_unused]] auto* writeLineBoolMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Bool), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Bool), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "WriteLine", args, nullptr);
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("WriteLine"), args, nullptr);
         method->AReturnType = DataType::VoidType;
         method->AnalyzeArguments();
         consoleMethods.push_back(method);
@@ -68,10 +71,10 @@ ClassDeclNode* Semantic::CreateConsoleClass()
 
     [[maybe_unused]] auto* writeLineStrMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "WriteLine", args, nullptr);
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("WriteLine"), args, nullptr);
         method->AReturnType = DataType::VoidType;
         method->AnalyzeArguments();
         consoleMethods.push_back(method);
@@ -80,10 +83,10 @@ ClassDeclNode* Semantic::CreateConsoleClass()
 
     [[maybe_unused]] auto* writeStrMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "Write", args, nullptr);
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("Write"), args, nullptr);
         method->AReturnType = DataType::VoidType;
         method->AnalyzeArguments();
         consoleMethods.push_back(method);
@@ -92,10 +95,10 @@ ClassDeclNode* Semantic::CreateConsoleClass()
 
     [[maybe_unused]] auto* writeLineCharMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Char), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Char), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "WriteLine", args, nullptr);
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("WriteLine"), args, nullptr);
         method->AReturnType = DataType::VoidType;
         method->AnalyzeArguments();
         consoleMethods.push_back(method);
@@ -104,17 +107,17 @@ ClassDeclNode* Semantic::CreateConsoleClass()
 
     [[maybe_unused]] auto* writeCharMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Char), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Char), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "Write", args, nullptr);
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("Write"), args, nullptr);
         method->AReturnType = DataType::VoidType;
         method->AnalyzeArguments();
         consoleMethods.push_back(method);
         return method;
     }();
 
-    auto* consoleClass = new ClassDeclNode("Console", nullptr, consoleClassMembers);
+    auto* consoleClass = new ClassDeclNode(Symbol::Intern("Console"), nullptr, consoleClassMembers);
 
     for (auto* method : consoleMethods) { method->Class = consoleClass; }
 
@@ -127,10 +130,10 @@ ClassDeclNode* Semantic::CreateStringClass()
     auto& methods = members->Methods;
     [[maybe_unused]] auto* charAtMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "CharAt",
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("CharAt"),
                                           args, nullptr);
         method->AReturnType = DataType::CharType;
         method->AnalyzeArguments();
@@ -139,10 +142,10 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* equalsMethod = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "Equals",
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("Equals"),
                                           args, nullptr);
         method->AReturnType = DataType::BoolType;
         method->AnalyzeArguments();
@@ -151,10 +154,10 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* substring1Method = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), "startIndex", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Int), Symbol::Intern("startIndex"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "Substring",
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("Substring"),
                                           args, nullptr);
         method->AReturnType = STD_STRING_TYPE;
         method->AnalyzeArguments();
@@ -163,12 +166,12 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* substring2Method = [&]
     {
-        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::Int), "startIndex", nullptr);
-        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::Int), "length", nullptr);
+        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::Int), Symbol::Intern("startIndex"), nullptr);
+        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::Int), Symbol::Intern("length"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg1);
         args->Add(arg2);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "Substring",
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("Substring"),
                                           args, nullptr);
         method->AReturnType = STD_STRING_TYPE;
         method->AnalyzeArguments();
@@ -177,10 +180,10 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* indexOf1Method = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::Char), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::Char), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "IndexOf",
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("IndexOf"),
                                           args, nullptr);
         method->AReturnType = DataType::IntType;
         method->AnalyzeArguments();
@@ -189,10 +192,10 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* indexOf2Method = [&]
     {
-        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), "arg", nullptr);
+        auto* arg = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("arg"), nullptr);
         auto* args = MethodArguments::MakeEmpty();
         args->Add(arg);
-        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, "IndexOf",
+        auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, Symbol::Intern("IndexOf"),
                                           args, nullptr);
         method->AReturnType = DataType::IntType;
         method->AnalyzeArguments();
@@ -201,8 +204,8 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* operatorPlus = [&]
     {
-        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::String), "lhs", nullptr);
-        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::String), "rhs", nullptr);
+        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("lhs"), nullptr);
+        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("rhs"), nullptr);
         auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, OperatorType::Plus,
                                           arg1, arg2, nullptr);
         method->AReturnType = STD_STRING_TYPE;
@@ -212,8 +215,8 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* operatorEqual = [&]
     {
-        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::String), "lhs", nullptr);
-        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::String), "rhs", nullptr);
+        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("lhs"), nullptr);
+        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("rhs"), nullptr);
         auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, OperatorType::Equal,
                                           arg1, arg2, nullptr);
         method->AReturnType = DataType::BoolType;
@@ -223,8 +226,8 @@ ClassDeclNode* Semantic::CreateStringClass()
     }();
     [[maybe_unused]] auto* operatorNotEqual = [&]
     {
-        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::String), "lhs", nullptr);
-        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::String), "rhs", nullptr);
+        auto* arg1 = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("lhs"), nullptr);
+        auto* arg2 = new VarDeclNode(new TypeNode(StandardType::String), Symbol::Intern("rhs"), nullptr);
         auto* method = new MethodDeclNode(VisibilityModifier::Public, nullptr, OperatorType::NotEqual,
                                           arg1, arg2, nullptr);
         method->AReturnType = DataType::BoolType;
@@ -236,16 +239,54 @@ ClassDeclNode* Semantic::CreateStringClass()
     [[maybe_unused]] auto* lengthField = [&]
     {
         auto* field = new FieldDeclNode(VisibilityModifier::Public,
-                                        new VarDeclNode(new TypeNode(StandardType::Int), "Length", nullptr));
+                                        new VarDeclNode(new TypeNode(StandardType::Int), Symbol::Intern("Length"), nullptr));
         field->IsFinal = true;
         members->Fields.push_back(field);
         field->VarDecl->AType = ToDataType(field->VarDecl->VarType);
         return field;
     }();
 
-    auto* stringClass = new ClassDeclNode("String", nullptr, members);
+    auto* stringClass = new ClassDeclNode(Symbol::Intern("String"), nullptr, members);
 
     for (auto* method : methods) { method->Class = stringClass; }
 
     return stringClass;
 }
+
+std::map<std::string, Bytes> Semantic::Generate()
+{
+    if (!Errors.empty())
+        return {};
+
+    // Analyzers are made up front: the constructor may add a default constructor to the class
+    std::vector<std::unique_ptr<ClassAnalyzer>> analyzers;
+    for (auto* namespace_ : program->Namespaces->GetSeq())
+    {
+        if (namespace_->NamespaceName == "System")
+            continue;
+        for (auto* class_ : namespace_->Members->Classes)
+        {
+            analyzers.push_back(std::make_unique<ClassAnalyzer>(class_, namespace_, program->Namespaces));
+            analyzers.back()->File.Peephole = Peephole;
+        }
+    }
+
+    // Each class has its own constant pool, the tree is only read
+    std::vector<Bytes> classFiles(analyzers.size());
+    ParallelFor(analyzers.size(), Jobs, [&](const size_t i)
+    {
+        analyzers[i]->FillTables();
+        classFiles[i] = analyzers[i]->ToClassFile();
+    });
+
+    std::map<std::string, Bytes> classes;
+    for (size_t i = 0; i < analyzers.size(); ++i)
+    {
+        CodeLengthBeforePeephole += analyzers[i]->File.CodeLengthBeforePeephole;
+        CodeLength += analyzers[i]->File.CodeLength;
+        // Compile rejects a class declared twice in a namespace before the analysis
+        if (!classes.emplace(analyzers[i]->File.ClassName, std::move(classFiles[i])).second)
+            throw std::runtime_error{ "Internal error: class " + analyzers[i]->File.ClassName + " is generated twice" };
+    }
+    return classes;
+}
@@ -1,6 +1,8 @@
 #pragma once
+#include <map>
 #include <vector>
 #include <set>
+#include <string>
 #include "JvmClass.h"
 #include "ClassAnalyzer.h"
 
@@ -20,6 +22,13 @@ struct Semantic
 
     std::set<std::string> Errors;
 
+    PeepholeOptions Peephole{};
+    // Code bytes of all generated methods before and after the peephole pass
+    size_t CodeLengthBeforePeephole = 0;
+    size_t CodeLength = 0;
+    // Threads generating class files
+    unsigned Jobs = 1;
+
     void Analyze()
     {
         CheckSystemNamespace();
@@ -69,22 +78,7 @@ struct Semantic
         }
     } // TODO enums
 
-    void Generate() const
-    {
-        if (Errors.empty())
-        {
-            for (auto* namespace_ : program->Namespaces->GetSeq())
-            {
-                if (namespace_->NamespaceName != "System")
-                {
-                    for (auto* class_ : namespace_->Members->Classes)
-                    {
-                        ClassAnalyzer analyzer(class_, namespace_, program->Namespaces);
-                        analyzer.FillTables();
-                        analyzer.Generate();
-                    }
-                }
-            }
-        }
-    }
+    // Class files by internal name, like ns/Class. Classes are independent once analyzed, so Jobs threads
+    // generate them concurrently. The output does not depend on the number of threads
+    [[nodiscard]] std::map<std::string, Bytes> Generate();
 };
@@ -0,0 +1,558 @@
+#include "StackMap.h"
+#include "ClassAnalyzer.h"
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    using TypeT = VerificationType::TypeT;
+
+    constexpr auto ObjectClassName = "java/lang/Object";
+
+    struct TypeState
+    {
+        std::vector<VerificationType> Locals;
+        std::vector<VerificationType> Stack;
+    };
+
+    VerificationType Object(ConstantTable& constants, const std::string_view className)
+    {
+        return { TypeT::Object, constants.FindClass(className) };
+    }
+
+    std::string_view Utf8(ConstantTable const& constants, const IdT id)
+    {
+        return constants.Constants[id - 1].Utf8;
+    }
+
+    std::string_view ClassName(ConstantTable const& constants, const uint32_t classId)
+    {
+        return Utf8(constants, constants.Constants[classId - 1].ClassNameId);
+    }
+
+    std::string_view RefName(ConstantTable const& constants, const int32_t refId)
+    {
+        const auto& ref = constants.Constants[refId - 1];
+        return Utf8(constants, constants.Constants[ref.NameAndTypeId - 1].NameId);
+    }
+
+    // Length of the single type descriptor descriptor starts with
+    size_t TypeDescriptorLength(const std::string_view descriptor)
+    {
+        auto end = descriptor.find_first_not_of('[');
+        if (descriptor[end] == 'L')
+            end = descriptor.find(';', end);
+        return end + 1;
+    }
+
+    VerificationType FromDescriptor(ConstantTable& constants, const std::string_view descriptor)
+    {
+        switch (descriptor[0])
+        {
+            case 'Z':
+            case 'B':
+            case 'C':
+            case 'S':
+            case 'I':
+                return { TypeT::Integer };
+            case 'F':
+                return { TypeT::Float };
+            case 'L':
+                return Object(constants, descriptor.substr(1, TypeDescriptorLength(descriptor) - 2));
+            case '[':
+                // Class constants of arrays are named by their descriptors
+                return Object(constants, descriptor.substr(0, TypeDescriptorLength(descriptor)));
+            default:
+                throw std::runtime_error{ "Internal error: no verification type for descriptor "
+                                          + std::string{ descriptor } };
+        }
+    }
+
+    // Argument descriptors of a method descriptor followed by its return descriptor
+    std::vector<std::string_view> SplitMethodDescriptor(const std::string_view descriptor)
+    {
+        std::vector<std::string_view> types;
+        size_t i = 1;
+        while (descriptor[i] != ')')
+        {
+            const auto length = TypeDescriptorLength(descriptor.substr(i));
+            types.push_back(descriptor.substr(i, length));
+            i += length;
+        }
+        types.push_back(descriptor.substr(i + 1));
+        return types;
+    }
+
+    std::string ArrayClassName(ConstantTable const& constants, const Instruction& instruction)
+    {
+        if (instruction.Opcode == Command::anewarray)
+        {
+            const auto elementName = ClassName(constants, instruction.Operand);
+            if (elementName.front() == '[')
+                return "[" + std::string{ elementName };
+            return "[L" + std::string{ elementName } + ";";
+        }
+
+        switch (instruction.Operand)
+        {
+            case 4:
+                return "[Z";
+            case 5:
+                return "[C";
+            case 6:
+                return "[F";
+            case 8:
+                return "[B";
+            case 9:
+                return "[S";
+            case 10:
+                return "[I";
+            default:
+                throw std::runtime_error{ "Internal error: unsupported newarray type "
+                                          + std::to_string(instruction.Operand) };
+        }
+    }
+
+    VerificationType Pop(TypeState& state)
+    {
+        if (state.Stack.empty())
+            throw std::runtime_error{ "Internal error: operand stack underflow while inferring stack map frames" };
+        const auto type = state.Stack.back();
+        state.Stack.pop_back();
+        return type;
+    }
+
+    VerificationType& Local(TypeState& state, const int32_t index)
+    {
+        if (index < 0 || (size_t)index >= state.Locals.size())
+            throw std::runtime_error{ "Internal error: local variable " + std::to_string(index) + " is out of range" };
+        return state.Locals[index];
+    }
+
+    void Execute(Assembler const& code, const size_t index, TypeState& state, ConstantTable& constants,
+                 const IdT thisClassId)
+    {
+        const auto& instruction = code.Instructions[index];
+        const auto push = [&state](const VerificationType type) { state.Stack.push_back(type); };
+        constexpr VerificationType integer{ TypeT::Integer };
+
+        switch (instruction.Opcode)
+        {
+            case Command::nop:
+            case Command::iinc:
+            case Command::goto_:
+            case Command::goto_w:
+            case Command::return_:
+                return;
+            case Command::aconst_null:
+                push({ TypeT::Null });
+                return;
+            case Command::iconst_m1:
+            case Command::iconst_0:
+            case Command::iconst_1:
+            case Command::iconst_2:
+            case Command::iconst_3:
+            case Command::iconst_4:
+            case Command::iconst_5:
+            case Command::bipush:
+            case Command::sipush:
+            case Command::iload:
+                push(integer);
+                return;
+            case Command::ldc:
+            case Command::ldc_w:
+            {
+                switch (constants.Constants[instruction.Operand - 1].Type)
+                {
+                    case Constant::TypeT::Integer:
+                        push(integer);
+                        return;
+                    case Constant::TypeT::Float:
+                        push({ TypeT::Float });
+                        return;
+                    case Constant::TypeT::String:
+                        push(Object(constants, "java/lang/String"));
+                        return;
+                    case Constant::TypeT::Class:
+                        push(Object(constants, "java/lang/Class"));
+                        return;
+                    default:
+                        throw std::runtime_error{ "Internal error: ldc of an unsupported constant" };
+                }
+            }
+            case Command::aload:
+                push(Local(state, instruction.Operand));
+                return;
+            case Command::aload_0:
+                push(Local(state, 0));
+                return;
+            case Command::istore:
+            case Command::astore:
+                Local(state, instruction.Operand) = Pop(state);
+                return;
+            case Command::pop:
+                Pop(state);
+                return;
+            case Command::dup:
+            {
+                const auto top = Pop(state);
+                push(top);
+                push(top);
+                return;
+            }
+            case Command::dup2:
+            {
+                const auto top = Pop(state);
+                const auto second = Pop(state);
+                for (auto i = 0; i < 2; ++i)
+                {
+                    push(second);
+                    push(top);
+                }
+                return;
+            }
+            case Command::iadd:
+            case Command::isub:
+            case Command::imul:
+            case Command::idiv:
+            case Command::iaload:
+            case Command::baload:
+            case Command::caload:
+                Pop(state);
+                Pop(state);
+                push(integer);
+                return;
+            case Command::ineg:
+            case Command::arraylength:
+            case Command::instanceof:
+                Pop(state);
+                push(integer);
+                return;
+            case Command::aaload:
+            {
+                Pop(state);
+                const auto array = Pop(state);
+                if (array.Type == TypeT::Null)
+                    push(array);
+                else
+                    push(FromDescriptor(constants, ClassName(constants, array.Data).substr(1)));
+                return;
+            }
+            case Command::ifeq:
+            case Command::ifne:
+            case Command::iflt:
+            case Command::ifge:
+            case Command::ifgt:
+            case Command::ifle:
+            case Command::ifnull:
+            case Command::ifnonnull:
+            case Command::tableswitch:
+            case Command::lookupswitch:
+            case Command::ireturn:
+            case Command::areturn:
+            case Command::putstatic:
+                Pop(state);
+                return;
+            case Command::if_icmpeq:
+            case Command::if_icmpne:
+            case Command::if_icmplt:
+            case Command::if_icmpge:
+            case Command::if_icmpgt:
+            case Command::if_icmple:
+            case Command::if_acmpeq:
+            case Command::if_acmpne:
+            case Command::putfield:
+                Pop(state);
+                Pop(state);
+                return;
+            case Command::iastore:
+            case Command::aastore:
+            case Command::bastore:
+            case Command::castore:
+                Pop(state);
+                Pop(state);
+                Pop(state);
+                return;
+            case Command::newarray:
+            case Command::anewarray:
+                Pop(state);
+                push(Object(constants, ArrayClassName(constants, instruction)));
+                return;
+            case Command::new_:
+                push({ TypeT::Uninitialized, (uint32_t)index });
+                return;
+            case Command::checkcast:
+                Pop(state);
+                push({ TypeT::Object, (uint32_t)instruction.Operand });
+                return;
+            case Command::getfield:
+                Pop(state);
+                push(FromDescriptor(constants, RefDescriptor(constants, instruction.Operand)));
+                return;
+            case Command::getstatic:
+                push(FromDescriptor(constants, RefDescriptor(constants, instruction.Operand)));
+                return;
+            case Command::invokevirtual:
+            case Command::invokespecial:
+            case Command::invokestatic:
+            {
+                const auto types = SplitMethodDescriptor(RefDescriptor(constants, instruction.Operand));
+                for (size_t i = 0; i + 1 < types.size(); ++i) { Pop(state); }
+                if (instruction.Opcode != Command::invokestatic)
+                {
+                    const auto receiver = Pop(state);
+                    const auto isUninitialized = receiver.Type == TypeT::UninitializedThis
+                                                 || receiver.Type == TypeT::Uninitialized;
+                    if (instruction.Opcode == Command::invokespecial && isUninitialized
+                        && RefName(constants, instruction.Operand) == "<init>")
+                    {
+                        // The constructor call initializes every copy of the reference
+                        const VerificationType initialized = {
+                            TypeT::Object,
+                            receiver.Type == TypeT::UninitializedThis
+                                ? thisClassId
+                                : (uint32_t)code.Instructions[receiver.Data].Operand
+                        };
+                        std::replace(state.Locals.begin(), state.Locals.end(), receiver, initialized);
+                        std::replace(state.Stack.begin(), state.Stack.end(), receiver, initialized);
+                    }
+                }
+                if (types.back() != "V")
+                    push(FromDescriptor(constants, types.back()));
+                return;
+            }
+            // Written only by Assembler::Assemble, never in Instructions
+            case Command::iload_0:
+            case Command::istore_0:
+            case Command::astore_0:
+            case Command::wide:
+                break;
+        }
+        throw std::runtime_error{ "Internal error: no stack map rule for opcode "
+                                  + std::to_string((int)instruction.Opcode) };
+    }
+
+    // The narrowest type both values are assignable to
+    VerificationType MergeValue(ConstantTable& constants, const VerificationType current,
+                                const VerificationType incoming, const bool isStackValue)
+    {
+        if (current == incoming)
+            return current;
+        if (current.Type == TypeT::Null && incoming.Type == TypeT::Object)
+            return incoming;
+        if (current.Type == TypeT::Object && incoming.Type == TypeT::Null)
+            return current;
+        // A local with unrelated types on different paths is dead or reassigned before it is read
+        if (!isStackValue)
+            return { TypeT::Top };
+        if (current.Type == TypeT::Object && incoming.Type == TypeT::Object)
+            return Object(constants, ObjectClassName);
+        throw std::runtime_error{ "Internal error: incompatible operand stack values where control flow merges" };
+    }
+
+    // Widens target so that incoming is assignable to it. Returns whether target changed
+    bool Merge(ConstantTable& constants, TypeState& target, TypeState const& incoming)
+    {
+        if (target.Stack.size() != incoming.Stack.size())
+            throw std::runtime_error{ "Internal error: operand stack depth differs where control flow merges" };
+
+        auto changed = false;
+        const auto mergeInto = [&](std::vector<VerificationType>& current, std::vector<VerificationType> const& other,
+                                   const bool isStack)
+        {
+            for (size_t i = 0; i < current.size(); ++i)
+            {
+                const auto merged = MergeValue(constants, current[i], other[i], isStack);
+                if (merged != current[i])
+                {
+                    current[i] = merged;
+                    changed = true;
+                }
+            }
+        };
+        mergeInto(target.Locals, incoming.Locals, false);
+        mergeInto(target.Stack, incoming.Stack, true);
+        return changed;
+    }
+
+    std::vector<VerificationType> WithoutTrailingTop(std::vector<VerificationType> locals)
+    {
+        while (!locals.empty() && locals.back().Type == TypeT::Top)
+            locals.pop_back();
+        return locals;
+    }
+
+    void WriteType(ByteWriter& bytes, const VerificationType type, std::vector<size_t> const& offsets)
+    {
+        bytes.Write((uint8_t)type.Type);
+        if (type.Type == TypeT::Object)
+            bytes.WriteU2((uint16_t)type.Data);
+        else if (type.Type == TypeT::Uninitialized)
+            bytes.WriteU2((uint16_t)offsets[type.Data]);
+    }
+
+    void WriteTypes(ByteWriter& bytes, std::vector<VerificationType> const& types, std::vector<size_t> const& offsets)
+    {
+        bytes.WriteU2((uint16_t)types.size());
+        for (const auto type : types) { WriteType(bytes, type, offsets); }
+    }
+}
+
+std::vector<VerificationType> EntryLocals(ConstantTable& constants, const std::string_view thisClass,
+                                          const std::string_view descriptor, const bool isStatic,
+                                          const bool isConstructor, const uint16_t maxLocals)
+{
+    std::vector<VerificationType> locals;
+    if (!isStatic)
+    {
+        if (isConstructor)
+            locals.push_back({ TypeT::UninitializedThis });
+        else
+            locals.push_back(Object(constants, thisClass));
+    }
+
+    auto types = SplitMethodDescriptor(descriptor);
+    types.pop_back();
+    for (const auto type : types) { locals.push_back(FromDescriptor(constants, type)); }
+
+    if (locals.size() < maxLocals)
+        locals.resize(maxLocals, { TypeT::Top });
+    return locals;
+}
+
+std::vector<StackMapFrame> InferFrames(Assembler const& code, std::vector<size_t> const& offsets,
+                                       ConstantTable& constants, const std::string_view thisClass,
+                                       std::vector<VerificationType> const& entryLocals)
+{
+    const auto& instructions = code.Instructions;
+    const auto thisClassId = constants.FindClass(thisClass);
+
+    std::vector<std::optional<TypeState>> states(instructions.size());
+    std::vector<size_t> worklist;
+    const auto flowInto = [&](const size_t index, TypeState const& state)
+    {
+        if (index >= instructions.size())
+            throw std::runtime_error{ "Internal error: control flow runs past the end of the method" };
+        if (!states[index])
+        {
+            states[index] = state;
+            worklist.push_back(index);
+        }
+        else if (Merge(constants, *states[index], state))
+            worklist.push_back(index);
+    };
+
+    if (!instructions.empty())
+        flowInto(0, { entryLocals, {} });
+    while (!worklist.empty())
+    {
+        const auto index = worklist.back();
+        worklist.pop_back();
+
+        auto state = *states[index];
+        Execute(code, index, state, constants, thisClassId);
+
+        const auto opcode = instructions[index].Opcode;
+        if (IsJump(opcode))
+            flowInto(code.LabelPositions[instructions[index].Target], state);
+        if (!EndsFlow(opcode))
+            flowInto(index + 1, state);
+    }
+
+    std::vector<bool> needsFrame(instructions.size());
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        const auto opcode = instructions[i].Opcode;
+        if (!IsJump(opcode))
+            continue;
+        needsFrame[code.LabelPositions[instructions[i].Target]] = true;
+        // A promoted conditional jump skips over its goto_w to the next instruction
+        constexpr auto jumpLength = 3;
+        if (opcode != Command::goto_ && offsets[i + 1] - offsets[i] > jumpLength)
+            needsFrame[i + 1] = true;
+    }
+
+    std::vector<StackMapFrame> frames;
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        if (needsFrame[i] && states[i])
+            frames.push_back({ i, states[i]->Locals, states[i]->Stack });
+    }
+    return frames;
+}
+
+void WriteStackMapTable(ByteWriter& bytes, std::vector<StackMapFrame> const& frames,
+                        std::vector<VerificationType> const& entryLocals, std::vector<size_t> const& offsets)
+{
+    constexpr auto sameFrameMax = 63;
+    constexpr auto sameLocalsOneStackItem = 64;
+    constexpr auto sameLocalsOneStackItemExtended = 247;
+    constexpr auto sameFrameExtended = 251;
+    constexpr auto fullFrame = 255;
+    constexpr size_t maxChangedLocals = 3;
+
+    bytes.WriteU2((uint16_t)frames.size());
+
+    auto previousLocals = WithoutTrailingTop(entryLocals);
+    // The first frame's offset_delta is its offset, later ones store the distance minus one
+    int64_t previousOffset = -1;
+    for (auto const& frame : frames)
+    {
+        const auto offset = (int64_t)offsets[frame.Instruction];
+        const auto offsetDelta = (uint16_t)(offset - previousOffset - 1);
+        auto locals = WithoutTrailingTop(frame.Locals);
+
+        const auto sameLocals = locals == previousLocals;
+        const auto commonLocals = std::min(locals.size(), previousLocals.size());
+        const auto sharesPrefix = std::equal(locals.begin(), locals.begin() + commonLocals, previousLocals.begin());
+
+        if (sameLocals && frame.Stack.empty())
+        {
+            if (offsetDelta <= sameFrameMax)
+                bytes.Write((uint8_t)offsetDelta);
+            else
+            {
+                bytes.Write((uint8_t)sameFrameExtended);
+                bytes.WriteU2(offsetDelta);
+            }
+        }
+        else if (sameLocals && frame.Stack.size() == 1)
+        {
+            if (offsetDelta <= sameFrameMax)
+                bytes.Write((uint8_t)(sameLocalsOneStackItem + offsetDelta));
+            else
+            {
+                bytes.Write((uint8_t)sameLocalsOneStackItemExtended);
+                bytes.WriteU2(offsetDelta);
+            }
+            WriteType(bytes, frame.Stack.front(), offsets);
+        }
+        else if (frame.Stack.empty() && sharesPrefix && locals.size() < previousLocals.size()
+                 && previousLocals.size() - locals.size() <= maxChangedLocals)
+        {
+            // chop_frame
+            bytes.Write((uint8_t)(sameFrameExtended - (previousLocals.size() - locals.size())));
+            bytes.WriteU2(offsetDelta);
+        }
+        else if (frame.Stack.empty() && sharesPrefix && locals.size() > previousLocals.size()
+                 && locals.size() - previousLocals.size() <= maxChangedLocals)
+        {
+            // append_frame
+            bytes.Write((uint8_t)(sameFrameExtended + (locals.size() - previousLocals.size())));
+            bytes.WriteU2(offsetDelta);
+            for (auto i = previousLocals.size(); i < locals.size(); ++i) { WriteType(bytes, locals[i], offsets); }
+        }
+        else
+        {
+            bytes.Write((uint8_t)fullFrame);
+            bytes.WriteU2(offsetDelta);
+            WriteTypes(bytes, locals, offsets);
+            WriteTypes(bytes, frame.Stack, offsets);
+        }
+
+        previousLocals = std::move(locals);
+        previousOffset = offset;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "Assembler.h"
+
+struct ConstantTable;
+
+// verification_type_info of the class file format
+struct VerificationType
+{
+    enum class TypeT : uint8_t
+    {
+        Top = 0,
+        Integer = 1,
+        Float = 2,
+        Double = 3,
+        Long = 4,
+        Null = 5,
+        UninitializedThis = 6,
+        Object = 7,
+        Uninitialized = 8
+    } Type{};
+
+    // Class constant of Object, index of the creating new instruction of Uninitialized
+    uint32_t Data = 0;
+
+    friend bool operator==(const VerificationType& lhs, const VerificationType& rhs)
+    {
+        return lhs.Type == rhs.Type && lhs.Data == rhs.Data;
+    }
+
+    friend bool operator!=(const VerificationType& lhs, const VerificationType& rhs) { return !(lhs == rhs); }
+};
+
+struct StackMapFrame
+{
+    // Index of the instruction the frame describes
+    size_t Instruction = 0;
+    std::vector<VerificationType> Locals;
+    std::vector<VerificationType> Stack;
+};
+
+// Types of this and the arguments on entry into the method, padded with Top up to maxLocals
+[[nodiscard]] std::vector<VerificationType> EntryLocals(ConstantTable& constants, std::string_view thisClass,
+                                                        std::string_view descriptor, bool isStatic,
+                                                        bool isConstructor, uint16_t maxLocals);
+
+// Infers local and stack types at every instruction and returns the frames the split verifier needs:
+// at jump targets and after promoted conditional jumps. offsets come from Assembler::Assemble
+[[nodiscard]] std::vector<StackMapFrame> InferFrames(Assembler const& code, std::vector<size_t> const& offsets,
+                                                     ConstantTable& constants, std::string_view thisClass,
+                                                     std::vector<VerificationType> const& entryLocals);
+
+// Writes the body of the StackMapTable attribute with each frame compressed against the previous one
+void WriteStackMapTable(ByteWriter& bytes, std::vector<StackMapFrame> const& frames,
+                        std::vector<VerificationType> const& entryLocals, std::vector<size_t> const& offsets);
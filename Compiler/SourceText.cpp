@@ -0,0 +1,174 @@
+#include "SourceText.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t ZerosAfterText = 2;
+
+    size_t PageSize()
+    {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+#else
+        return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+    }
+
+    // The system fills the rest of the last mapped page with zeros, the lexer needs two of them
+    bool LastPageHasZeros(const size_t size)
+    {
+        const auto usedInLastPage = size % PageSize();
+        return size != 0 && usedInLastPage != 0 && PageSize() - usedInLastPage >= ZerosAfterText;
+    }
+
+    // Maps the file copy-on-write, returns nullptr if it cannot be mapped with the zeros after the text
+    char* MapFile(const std::string& path, size_t& size)
+    {
+#ifdef _WIN32
+        const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                      FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw std::runtime_error{ "Cannot open " + path };
+        LARGE_INTEGER fileSize{};
+        void* view = nullptr;
+        if (GetFileSizeEx(file, &fileSize) && (uint64_t)fileSize.QuadPart <= SIZE_MAX)
+        {
+            size = (size_t)fileSize.QuadPart;
+            if (LastPageHasZeros(size))
+            {
+                if (const auto mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr))
+                {
+                    view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                    CloseHandle(mapping);
+                }
+            }
+        }
+        CloseHandle(file);
+        return (char*)view;
+#else
+        const auto file = open(path.c_str(), O_RDONLY);
+        if (file < 0)
+            throw std::runtime_error{ "Cannot open " + path };
+        struct stat status{};
+        void* view = MAP_FAILED;
+        if (fstat(file, &status) == 0)
+        {
+            size = (size_t)status.st_size;
+            // The zeros are mapped with the text, they are still in the last page of the file
+            if (LastPageHasZeros(size))
+                view = mmap(nullptr, size + ZerosAfterText, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+        }
+        close(file);
+        return view == MAP_FAILED ? nullptr : (char*)view;
+#endif
+    }
+}
+
+SourceText SourceText::FromFile(const std::string& path)
+{
+    size_t size = 0;
+    if (auto* view = MapFile(path, size))
+    {
+        SourceText text;
+        text.name = path;
+        text.data = view;
+        text.size = size;
+        text.mappedLength = size + ZerosAfterText;
+        return text;
+    }
+
+    std::ifstream in{ path, std::ios_base::in | std::ios_base::binary };
+    if (!in)
+        throw std::runtime_error{ "Cannot open " + path };
+    auto text = Allocate(size);
+    text.name = path;
+    in.read(text.data, (std::streamsize)size);
+    if ((size_t)in.gcount() != size)
+        throw std::runtime_error{ "Cannot read " + path };
+    return text;
+}
+
+SourceText SourceText::FromStream(std::istream& in, std::string name)
+{
+    std::string content;
+    std::array<char, 64 * 1024> chunk{};
+    while (in.read(chunk.data(), chunk.size()) || in.gcount() > 0)
+        content.append(chunk.data(), (size_t)in.gcount());
+    return Copy(content, std::move(name));
+}
+
+SourceText SourceText::Copy(const std::string_view text, std::string name)
+{
+    auto result = Allocate(text.size());
+    result.name = std::move(name);
+    std::copy(text.begin(), text.end(), result.data);
+    return result;
+}
+
+SourceText SourceText::Allocate(const size_t size)
+{
+    SourceText text;
+    text.owned = std::make_unique<char[]>(size + ZerosAfterText);
+    text.data = text.owned.get();
+    text.size = size;
+    return text;
+}
+
+SourceText::SourceText(SourceText&& other) noexcept
+    : name{ std::move(other.name) }
+  , data{ std::exchange(other.data, nullptr) }
+  , size{ std::exchange(other.size, 0) }
+  , owned{ std::move(other.owned) }
+  , mappedLength{ std::exchange(other.mappedLength, 0) }
+{
+}
+
+SourceText& SourceText::operator=(SourceText&& other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        name = std::move(other.name);
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        owned = std::move(other.owned);
+        mappedLength = std::exchange(other.mappedLength, 0);
+    }
+    return *this;
+}
+
+SourceText::~SourceText() { Release(); }
+
+void SourceText::Release() noexcept
+{
+    if (mappedLength != 0)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap(data, mappedLength);
+#endif
+    }
+    owned.reset();
+    data = nullptr;
+    size = 0;
+    mappedLength = 0;
+}
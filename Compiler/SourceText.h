@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Source text laid out the way the lexer scans it in place: writable and followed by two zero bytes,
+// because flex puts a zero after each token while it looks at it.
+// A file is mapped copy-on-write, so it is neither read into a buffer nor changed on disk
+class SourceText
+{
+public:
+    // Maps the file, or reads it when its last page has no room for the zero bytes.
+    // The path becomes the name. Throws std::runtime_error if the file cannot be opened
+    [[nodiscard]] static SourceText FromFile(const std::string& path);
+
+    [[nodiscard]] static SourceText FromStream(std::istream& in, std::string name = {});
+
+    [[nodiscard]] static SourceText Copy(std::string_view text, std::string name = {});
+
+    SourceText(SourceText&& other) noexcept;
+
+    SourceText& operator=(SourceText&& other) noexcept;
+
+    SourceText(const SourceText&) = delete;
+
+    SourceText& operator=(const SourceText&) = delete;
+
+    ~SourceText();
+
+    [[nodiscard]] std::string_view Text() const { return { data, size }; }
+
+    // Shown in the errors of this source, empty for a nameless text
+    [[nodiscard]] std::string const& Name() const { return name; }
+
+    // The text with the two zero bytes after it, for yy_scan_buffer
+    [[nodiscard]] char* ScanBuffer() { return data; }
+
+    [[nodiscard]] size_t ScanBufferSize() const { return size + 2; }
+
+    [[nodiscard]] bool IsMapped() const { return mappedLength != 0; }
+
+private:
+    SourceText() = default;
+
+    std::string name;
+    char* data = nullptr;
+    size_t size = 0;
+    // Text read or copied into memory, data points into it
+    std::unique_ptr<char[]> owned;
+    // Length of the mapped view, 0 if the text is owned
+    size_t mappedLength = 0;
+
+    static SourceText Allocate(size_t size);
+
+    void Release() noexcept;
+};
@@ -0,0 +1,87 @@
+// Fills one ConstantTable with about 60000 constants the way a large class fills its pool: ints, string literals,
+// method and field refs of many classes and some floats, -0.0 and a NaN among them. Then it looks every one of them
+// up again, 10 rounds or as many as the argument says. Prints the time of both and fails if a lookup gives another id
+// than the first time.
+//
+// Not a part of Compiler.vcxproj. It needs neither the lexer nor the parser, build it in Compiler with the sources
+// of Semantic and Tree, for example
+//     g++ -std=c++17 -O2 -I. -I../Common Tests/Drivers/ConstantTableBench.cpp Semantic/*.cpp Tree/*.cpp
+// and run it there as ConstantTableBench [rounds]
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Semantic/ClassAnalyzer.h"
+
+namespace
+{
+    constexpr auto IntsCount = 29000;
+    constexpr auto StringsCount = 10000;
+    constexpr auto ClassesCount = 100;
+    constexpr auto MethodsPerClass = 60;
+    constexpr auto FieldsPerClass = 40;
+    constexpr auto FloatsCount = 1000;
+
+    // Interns every constant once and returns the ids in the order they were asked for
+    std::vector<IdT> Intern(ConstantTable& constants)
+    {
+        std::vector<IdT> ids;
+        for (auto i = 0; i < IntsCount; ++i) { ids.push_back(constants.FindInt(i * 7919)); }
+        for (auto i = 0; i < StringsCount; ++i)
+        {
+            ids.push_back(constants.FindString("Literal number " + std::to_string(i)));
+        }
+        for (auto c = 0; c < ClassesCount; ++c)
+        {
+            const auto className = "Namespace/Class" + std::to_string(c);
+            for (auto m = 0; m < MethodsPerClass; ++m)
+            {
+                ids.push_back(constants.FindMethodRef(className, "Method" + std::to_string(m), "(ILSystem/String;)V"));
+            }
+            for (auto f = 0; f < FieldsPerClass; ++f)
+            {
+                ids.push_back(constants.FindFieldRef(className, "Field" + std::to_string(f), "I"));
+            }
+        }
+        for (auto i = 0; i < FloatsCount - 2; ++i) { ids.push_back(constants.FindFloat(i * 0.5)); }
+        ids.push_back(constants.FindFloat(-0.0));
+        ids.push_back(constants.FindFloat(std::nan("")));
+        return ids;
+    }
+
+    double Seconds(const std::chrono::steady_clock::duration time)
+    {
+        return std::chrono::duration<double>{ time }.count();
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    const auto rounds = argc > 1 ? std::atoi(argv[1]) : 10;
+    ConstantTable constants;
+    auto start = std::chrono::steady_clock::now();
+    const auto ids = Intern(constants);
+    const auto internTime = std::chrono::steady_clock::now() - start;
+    std::cout << ids.size() << " constants, " << constants.Constants.size() << " pool entries interned in "
+              << Seconds(internTime) << " s" << std::endl;
+
+    auto failures = 0;
+    if (ids[ids.size() - 2] == constants.FindFloat(0.0))
+    {
+        std::cout << "-0.0 has the id of 0.0" << std::endl;
+        ++failures;
+    }
+    start = std::chrono::steady_clock::now();
+    for (auto round = 0; round < rounds; ++round)
+    {
+        if (Intern(constants) != ids)
+            ++failures;
+    }
+    const auto lookupTime = std::chrono::steady_clock::now() - start;
+    std::cout << rounds << " rounds of lookups in " << Seconds(lookupTime) << " s, " << failures
+              << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+// Prints the tokens the scanner returns for each file, one a line: the line number after the token, the token,
+// its text and its value. The lexer errors go to the standard error as usual, run it with 2>&1 to see them in place.
+// With -rules the tokens come from the flex rules alone, without the prescanner yylex adds to them.
+// With -check both scan each file and the first token they disagree on is printed, nothing else. That has to pass
+// over Tests/Lexer and Tests before yylex is let in for another flex version, see the end of Lexer.l.
+//
+// Not a part of Compiler.vcxproj. Once the lexer and the parser are generated, build it in Compiler with the sources
+// of the compiler but Main.cpp, for example
+//     g++ -std=c++17 -I. -I../Common Tests/Drivers/DumpTokens.cpp <compiler sources>
+// and run it there as DumpTokens [-rules | -check] Tests/Lexer/* Tests/*.cs
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SourceText.h"
+#include "Tree/Program.h"
+#include "Parser.tab.h"
+
+int yylex_init(yyscan_t* scanner);
+int yylex_destroy(yyscan_t scanner);
+void* yy_scan_buffer(char* base, size_t size, yyscan_t scanner);
+void yyset_lineno(int lineNumber, yyscan_t scanner);
+int yyget_lineno(yyscan_t scanner);
+int yyget_leng(yyscan_t scanner);
+char* yyget_text(yyscan_t scanner);
+int yylex(YYSTYPE* yylval, yyscan_t scanner);
+int ScanToken(YYSTYPE* yylval, yyscan_t scanner);
+
+namespace
+{
+    using ScanFunction = int (*)(YYSTYPE*, yyscan_t);
+
+    // Control characters and quotes are escaped, so a token takes one line
+    std::string Escape(const std::string_view text)
+    {
+        std::string escaped;
+        for (const auto c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                escaped += '\\';
+                escaped += c;
+            }
+            else if ((unsigned char)c < ' ')
+            {
+                char code[8];
+                std::snprintf(code, sizeof code, "\\x%02x", (unsigned char)c);
+                escaped += code;
+            }
+            else { escaped += c; }
+        }
+        return escaped;
+    }
+
+    // The tokens of the file as they are printed, the last line has the line number at the end
+    std::vector<std::string> Tokens(std::string const& file, const ScanFunction scan)
+    {
+        // Each scan gets its own buffer, flex writes into the one it reads
+        auto source = SourceText::FromFile(file);
+        yyscan_t scanner;
+        if (yylex_init(&scanner) != 0)
+            throw std::runtime_error{ "Cannot create the scanner" };
+        if (!yy_scan_buffer(source.ScanBuffer(), source.ScanBufferSize(), scanner))
+        {
+            yylex_destroy(scanner);
+            throw std::runtime_error{ "Source buffer does not end with two zero bytes" };
+        }
+        yyset_lineno(1, scanner);
+
+        std::vector<std::string> tokens;
+        YYSTYPE value{};
+        for (int token; (token = scan(&value, scanner)) != 0;)
+        {
+            auto line = std::to_string(yyget_lineno(scanner)) + " " + std::to_string(token) + " \""
+                        + Escape({ yyget_text(scanner), (size_t)yyget_leng(scanner) }) + "\"";
+            switch (token)
+            {
+            case IDENTIFIER: line += " " + std::string{ Symbol{ value._identifier }.Text() }; break;
+            case STRING: line += " \"" + Escape(Symbol{ value._string }.Text()) + "\""; break;
+            case INTEGER: line += " " + std::to_string(value._integer); break;
+            case FLOATING_POINT: line += " " + std::to_string(value._floatingPoint); break;
+            case CHARACTER: line += " " + std::to_string((int)value._character); break;
+            default: break;
+            }
+            tokens.push_back(std::move(line));
+        }
+        tokens.push_back(std::to_string(yyget_lineno(scanner)) + " end");
+        yylex_destroy(scanner);
+        return tokens;
+    }
+
+    // Returns whether yylex and the rules alone give the same tokens
+    bool Check(std::string const& file)
+    {
+        const auto tokens = Tokens(file, yylex);
+        const auto ruleTokens = Tokens(file, ScanToken);
+        for (size_t i = 0; i < tokens.size() || i < ruleTokens.size(); ++i)
+        {
+            const std::string token = i < tokens.size() ? tokens[i] : "(none)";
+            const std::string ruleToken = i < ruleTokens.size() ? ruleTokens[i] : "(none)";
+            if (token != ruleToken)
+            {
+                std::cout << file << ": token " << i + 1 << " is " << token << ", the rules alone give " << ruleToken
+                          << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    const std::string_view mode = argc > 1 ? argv[1] : "";
+    const auto isCheck = mode == "-check";
+    const auto scan = mode == "-rules" ? ScanToken : yylex;
+    try
+    {
+        auto differences = 0;
+        for (auto i = isCheck || mode == "-rules" ? 2 : 1; i < argc; ++i)
+        {
+            if (isCheck)
+            {
+                differences += !Check(argv[i]);
+                continue;
+            }
+            std::cout << "# " << argv[i] << std::endl;
+            for (auto const& token : Tokens(argv[i], scan)) { std::cout << token << std::endl; }
+        }
+        if (isCheck)
+            std::cout << differences << " files differ" << std::endl;
+        return differences == 0 ? 0 : 1;
+    }
+    catch (std::runtime_error const& error)
+    {
+        std::cout << error.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,162 @@
+// Parses N files on N threads, each into its own ParseContext, and then compiles each file on a thread of its own,
+// N compilations at once. Both are compared with the same work done on one thread: the trees must print the same
+// and the compilations must give the same errors and byte-identical class files.
+//
+// Not a part of Compiler.vcxproj. Once the lexer and the parser are generated, build it in Compiler with the sources
+// of the compiler but Main.cpp, for example
+//     g++ -std=c++17 -O1 -g -fsanitize=thread -I. -I../Common Tests/Drivers/ParallelParse.cpp <compiler sources> -lpthread
+// and run it there as ParallelParse Tests/*.cs, with -r <rounds> first to repeat the parallel runs
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Compilation.h"
+#include "Dot.h"
+#include "ParseContext.h"
+
+namespace
+{
+    // The tree as ToDot prints it, with the node ids numbered from 0 in the order they appear.
+    // Ids come from one counter for all threads, so the same tree gets other ids in another run
+    std::string PrintTree(Program* root)
+    {
+        std::ostringstream dot;
+        ToDot(root, dot);
+        const auto text = dot.str();
+
+        std::string printed;
+        std::vector<std::pair<std::string, size_t>> ids;
+        const auto renumber = [&](const std::string& id)
+        {
+            for (auto const& [old, number] : ids)
+            {
+                if (old == id)
+                    return std::to_string(number);
+            }
+            ids.emplace_back(id, ids.size());
+            return std::to_string(ids.size() - 1);
+        };
+        std::istringstream lines{ text };
+        for (std::string line; std::getline(lines, line);)
+        {
+            // Node lines start with the id, edge lines are "id1 -> id2"
+            size_t digits = 0;
+            while (digits < line.size() && std::isdigit((unsigned char)line[digits])) { ++digits; }
+            if (digits == 0)
+            {
+                printed += line + "\n";
+                continue;
+            }
+            printed += renumber(line.substr(0, digits));
+            auto rest = line.substr(digits);
+            constexpr std::string_view arrow = " -> ";
+            if (rest.compare(0, arrow.size(), arrow) == 0)
+            {
+                size_t end = arrow.size();
+                while (end < rest.size() && std::isdigit((unsigned char)rest[end])) { ++end; }
+                rest = std::string{ arrow } + renumber(rest.substr(arrow.size(), end - arrow.size())) + rest.substr(end);
+            }
+            printed += rest + "\n";
+        }
+        return printed;
+    }
+
+    // What parsing a file gives: the printed tree, or the syntax errors
+    std::string Parse(std::string const& file)
+    {
+        auto source = SourceText::FromFile(file);
+        ParseContext context;
+        NodeArena::Scope arenaScope{ context.Arena };
+        if (!ParseSource(source.ScanBuffer(), source.ScanBufferSize(), context))
+        {
+            std::string errors;
+            for (auto const& error : context.Errors) { errors += error + "\n"; }
+            return errors;
+        }
+        return PrintTree(context.Root);
+    }
+
+    CompilationResult CompileFile(std::string const& file)
+    {
+        std::vector<SourceText> sources;
+        sources.push_back(SourceText::FromFile(file));
+        return Compile(sources);
+    }
+
+    // Runs work(i) for every file, on one thread or on a thread per file
+    template <typename TResult, typename TWork>
+    std::vector<TResult> ForEachFile(size_t files, bool parallel, TWork work)
+    {
+        std::vector<TResult> results(files);
+        if (!parallel)
+        {
+            for (size_t i = 0; i < files; ++i) { results[i] = work(i); }
+            return results;
+        }
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < files; ++i)
+        {
+            threads.emplace_back([&, i] { results[i] = work(i); });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        return results;
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    auto rounds = 1;
+    std::vector<std::string> files;
+    for (auto i = 1; i < argc; ++i)
+    {
+        if (std::string_view{ argv[i] } == "-r" && i + 1 < argc) { rounds = std::atoi(argv[++i]); }
+        else { files.emplace_back(argv[i]); }
+    }
+    if (files.empty())
+    {
+        std::cout << "Usage: ParallelParse [-r rounds] file..." << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        const auto parse = [&](const size_t i) { return Parse(files[i]); };
+        const auto compile = [&](const size_t i) { return CompileFile(files[i]); };
+        const auto serialTrees = ForEachFile<std::string>(files.size(), false, parse);
+        const auto serialResults = ForEachFile<CompilationResult>(files.size(), false, compile);
+
+        auto failures = 0;
+        for (auto round = 0; round < rounds; ++round)
+        {
+            const auto trees = ForEachFile<std::string>(files.size(), true, parse);
+            const auto results = ForEachFile<CompilationResult>(files.size(), true, compile);
+            for (size_t i = 0; i < files.size(); ++i)
+            {
+                if (trees[i] != serialTrees[i])
+                {
+                    std::cout << files[i] << ": the tree differs from the serial parse" << std::endl;
+                    ++failures;
+                }
+                if (results[i].Errors != serialResults[i].Errors || results[i].Classes != serialResults[i].Classes)
+                {
+                    std::cout << files[i] << ": the compilation differs from the serial one" << std::endl;
+                    ++failures;
+                }
+            }
+        }
+        std::cout << files.size() << " files on " << files.size() << " threads, " << rounds << " rounds, "
+                  << failures << " differences" << std::endl;
+        return failures == 0 ? 0 : 1;
+    }
+    catch (std::runtime_error const& error)
+    {
+        std::cout << error.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,118 @@
+// Checks the prescanner against plain loops that do the same a byte at a time, over random texts and from every few
+// positions in them. Each text is alone in an allocation of its size, so a read past the end shows up with
+// -fsanitize=address or /fsanitize=address.
+//
+// Not a part of Compiler.vcxproj. Build it in Compiler once for each instruction set the prescanner has, for example
+//     g++ -std=c++17 -O2 -mavx2 -fsanitize=address -I. Tests/Drivers/PrescannerTest.cpp Prescanner.cpp
+// then without -mavx2 for SSE2 and with -U__SSE2__ for the byte at a time code, and run it with no arguments
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string_view>
+
+#include "Prescanner.h"
+
+namespace
+{
+    bool IsWhitespace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r'; }
+
+    bool IsIdentifierCharacter(const char c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    }
+
+    const char* ExpectedWhitespaceEnd(const char* position, const char* end, int& lines)
+    {
+        for (; position != end && IsWhitespace(*position); ++position) { lines += *position == '\n'; }
+        return position;
+    }
+
+    const char* ExpectedLineEnd(const char* position, const char* end)
+    {
+        while (position != end && *position != '\n') { ++position; }
+        return position;
+    }
+
+    const char* ExpectedCommentEnd(const char* position, const char* end, int& lines)
+    {
+        const std::string_view text{ position, (size_t)(end - position) };
+        const auto close = text.find("*/");
+        if (close == std::string_view::npos)
+            return nullptr;
+        for (size_t i = 0; i < close; ++i) { lines += text[i] == '\n'; }
+        return position + close + 2;
+    }
+
+    const char* ExpectedIdentifierEnd(const char* position, const char* end)
+    {
+        while (position != end && IsIdentifierCharacter(*position)) { ++position; }
+        return position;
+    }
+
+    const char* ExpectedStringLiteralEnd(const char* position, const char* end)
+    {
+        while (position != end && *position != '"' && *position != '\\' && *position != '\n') { ++position; }
+        return position;
+    }
+
+    bool Check(const bool passed, const char* function, const std::string_view text, const size_t start)
+    {
+        if (!passed)
+            std::printf("%s differs from %zu in a text of %zu bytes\n", function, start, text.size());
+        return passed;
+    }
+}
+
+int main()
+{
+    // The characters the functions look for are the likeliest, with runs of identifier characters and spaces
+    // long enough for several vectors. The rest are random bytes, the ones above 127 among them
+    constexpr std::string_view Likely = " \t\n\r\v\f*/\"\\_aZz09@[`{";
+    constexpr std::string_view Runs[] = { "                                        ", "abcdefghijklmnopqrstuvwxyz_0123456789ABCD",
+                                          "\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n", "****************" };
+    std::mt19937 random{ 1 };
+    size_t checks = 0;
+    for (auto iteration = 0; iteration < 200000; ++iteration)
+    {
+        const size_t size = random() % 160;
+        auto text = std::make_unique<char[]>(size);
+        for (size_t i = 0; i < size;)
+        {
+            const auto kind = random() % 8;
+            if (kind == 0)
+            {
+                const auto run = Runs[random() % std::size(Runs)].substr(0, random() % 40);
+                for (size_t j = 0; j < run.size() && i < size; ++j) { text[i++] = run[j]; }
+            }
+            else if (kind < 6) { text[i++] = Likely[random() % Likely.size()]; }
+            else { text[i++] = (char)random(); }
+        }
+
+        const char* const end = text.get() + size;
+        for (size_t start = 0; start <= size; start += 1 + random() % 7)
+        {
+            const char* const position = text.get() + start;
+            const std::string_view all{ text.get(), size };
+            auto lines = 0;
+            auto expectedLines = 0;
+            auto passed = Check(SkipWhitespace(position, end, lines) == ExpectedWhitespaceEnd(position, end, expectedLines)
+                                && lines == expectedLines, "SkipWhitespace", all, start);
+            passed &= Check(FindLineEnd(position, end) == ExpectedLineEnd(position, end), "FindLineEnd", all, start);
+            lines = 0;
+            expectedLines = 0;
+            // The lines are only counted for a comment that is closed
+            const auto* const commentEnd = SkipCommentBody(position, end, lines);
+            passed &= Check(commentEnd == ExpectedCommentEnd(position, end, expectedLines)
+                            && (commentEnd == nullptr || lines == expectedLines), "SkipCommentBody", all, start);
+            passed &= Check(SkipIdentifierCharacters(position, end) == ExpectedIdentifierEnd(position, end),
+                            "SkipIdentifierCharacters", all, start);
+            passed &= Check(FindStringLiteralEnd(position, end) == ExpectedStringLiteralEnd(position, end),
+                            "FindStringLiteralEnd", all, start);
+            if (!passed)
+                return 1;
+            checks += 5;
+        }
+    }
+    std::printf("%zu checks passed\n", checks);
+}
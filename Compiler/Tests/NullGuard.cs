@@ -0,0 +1,32 @@
+namespace NullGuard
+{
+    public class M
+    {
+        public int Value;
+
+        public int ValueOf(M other)
+        {
+            // other.Value is only read when other is not null
+            if (other != null && other.Value > 0)
+            {
+                return other.Value;
+            }
+            return 0;
+        }
+
+        public static void Main()
+        {
+            System.Console Console = new System.Console;
+            M m = new M;
+            m.Value = 7;
+            Console.WriteLine(m.ValueOf(m));
+            Console.WriteLine(m.ValueOf(null));
+
+            int[] array = new int[0];
+            if (array == null || array.Length == 0)
+            {
+                Console.WriteLine("empty");
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+namespace ShortCircuit
+{
+    public class M
+    {
+        public System.Console Console = new System.Console;
+        public bool Check(string name, bool value)
+        {
+            Console.Write(name);
+            return value;
+        }
+
+        public static void Main()
+        {
+            M m = new M;
+            System.Console Console = new System.Console;
+
+            // The guard keeps a[i] from reading past the end of the array
+            int[] a = new int[5];
+            a[0] = 3;
+            a[1] = 1;
+            a[2] = 4;
+            int count = 0;
+            int i = 0;
+            while (i < a.Length && a[i] != 0)
+            {
+                count = count + 1;
+                ++i;
+            }
+            Console.WriteLine(count);
+
+            // Prints "ABD": C is skipped once B is false, D decides the result
+            if (m.Check("A", true) && m.Check("B", false) && m.Check("C", true) || m.Check("D", true))
+            {
+                Console.WriteLine(" taken");
+            }
+
+            // Prints "A": the || is true as soon as A is true
+            bool result = m.Check("A", true) || m.Check("B", true) && m.Check("C", false);
+            Console.WriteLine(result);
+
+            // Prints "AB": the negated && stops at B
+            if (!(m.Check("A", true) && m.Check("B", false) && m.Check("C", true)))
+            {
+                Console.WriteLine(" negated");
+            }
+        }
+    }
+}
@@ -0,0 +1,16 @@
+namespace StringConcat
+{
+    public class M
+    {
+        public static void Main()
+        {
+            System.Console Console = new System.Console;
+            string name = "World";
+            int count = Console.ReadInt();
+
+            // One builder for the whole chain, the int, char and bool are appended as they are
+            Console.WriteLine("Hello, " + name + "! You have " + count + " new message" + 's' + ": " + (count > 0));
+            Console.WriteLine(count + " = " + (name + count));
+        }
+    }
+}
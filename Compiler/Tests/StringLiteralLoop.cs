@@ -0,0 +1,14 @@
+namespace StringLiteralLoop
+{
+    public class M
+    {
+        public static void Main()
+        {
+            var Console = new System.Console;
+            for (int i = 0; i < 1000000; ++i)
+            {
+                Console.WriteLine("Hello, World!");
+            }
+        }
+    }
+}
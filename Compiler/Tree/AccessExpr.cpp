@@ -41,7 +41,7 @@ AccessExpr* AccessExpr::FromFloat(double value)
     return node;
 }
 
-AccessExpr* AccessExpr::FromString(const char* const str)
+AccessExpr* AccessExpr::FromString(const Symbol str)
 {
     auto* node = new AccessExpr;
     node->Type = TypeT::String;
@@ -49,7 +49,7 @@ AccessExpr* AccessExpr::FromString(const char* const str)
     return node;
 }
 
-AccessExpr* AccessExpr::FromId(const char* const id)
+AccessExpr* AccessExpr::FromId(const Symbol id)
 {
     auto* node = new AccessExpr;
     node->Type = TypeT::Identifier;
@@ -73,7 +73,7 @@ AccessExpr* AccessExpr::FromChar(char value)
     return node;
 }
 
-AccessExpr* AccessExpr::FromCall(const char* const id, ExprSeqNode* arguments)
+AccessExpr* AccessExpr::FromCall(const Symbol id, ExprSeqNode* arguments)
 {
     auto* node = new AccessExpr;
     node->Type = TypeT::SimpleMethodCall;
@@ -82,7 +82,7 @@ AccessExpr* AccessExpr::FromCall(const char* const id, ExprSeqNode* arguments)
     return node;
 }
 
-AccessExpr* AccessExpr::FromDot(AccessExpr* previous, const char* const id)
+AccessExpr* AccessExpr::FromDot(AccessExpr* previous, const Symbol id)
 {
     auto* node = new AccessExpr;
     node->Type = TypeT::Dot;
@@ -91,7 +91,7 @@ AccessExpr* AccessExpr::FromDot(AccessExpr* previous, const char* const id)
     return node;
 }
 
-AccessExpr* AccessExpr::FromDot(AccessExpr* previous, const char* const id, ExprSeqNode* arguments)
+AccessExpr* AccessExpr::FromDot(AccessExpr* previous, const Symbol id, ExprSeqNode* arguments)
 {
     auto* node = new AccessExpr;
     node->Type = TypeT::DotMethodCall;
@@ -114,7 +114,7 @@ DataType AccessExpr::ToDataType() const
     {
         DataType data;
         data.AType = DataType::TypeT::Complex;
-        data.ComplexType = { std::string{ Identifier } };
+        data.ComplexType = { Identifier };
         return data;
     }
 
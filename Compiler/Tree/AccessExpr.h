@@ -32,8 +32,8 @@ struct AccessExpr final : Node
     int Integer{};
     double Float{};
     char Char{};
-    std::string_view String{};
-    std::string_view Identifier{};
+    Symbol String{};
+    Symbol Identifier{};
     bool Bool{};
 
     ExprSeqNode* Arguments{};
@@ -56,19 +56,19 @@ struct AccessExpr final : Node
 
     static AccessExpr* FromFloat(double value);
 
-    static AccessExpr* FromString(const char* str);
+    static AccessExpr* FromString(Symbol str);
 
-    static AccessExpr* FromId(const char* id);
+    static AccessExpr* FromId(Symbol id);
 
     static AccessExpr* FromBool(bool value);
 
     static AccessExpr* FromChar(char value);
 
-    static AccessExpr* FromCall(const char* id, ExprSeqNode* arguments);
+    static AccessExpr* FromCall(Symbol id, ExprSeqNode* arguments);
 
-    static AccessExpr* FromDot(AccessExpr* previous, const char* id);
+    static AccessExpr* FromDot(AccessExpr* previous, Symbol id);
 
-    static AccessExpr* FromDot(AccessExpr* previous, const char* id, ExprSeqNode* arguments);
+    static AccessExpr* FromDot(AccessExpr* previous, Symbol id, ExprSeqNode* arguments);
 
     [[nodiscard]] DataType ToDataType() const;
 
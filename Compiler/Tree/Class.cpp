@@ -1,6 +1,59 @@
 #include "Class.h"
 #include "Program.h"
 
+Symbol OperatorIdentifier(const OperatorType operator_)
+{
+    static const Symbol plus = Symbol::Intern("__operator_plus");
+    static const Symbol minus = Symbol::Intern("__operator_minus");
+    static const Symbol multiply = Symbol::Intern("__operator_multiply");
+    static const Symbol divide = Symbol::Intern("__operator_divide");
+    static const Symbol less = Symbol::Intern("__operator_less");
+    static const Symbol greater = Symbol::Intern("__operator_greater");
+    static const Symbol equal = Symbol::Intern("__operator_equal");
+    static const Symbol notEqual = Symbol::Intern("__operator_not_equal");
+    static const Symbol greaterOrEqual = Symbol::Intern("__operator_greater_or_equal");
+    static const Symbol lessOrEqual = Symbol::Intern("__operator_less_or_equal");
+    static const Symbol not_ = Symbol::Intern("__operator_not");
+    static const Symbol increment = Symbol::Intern("__operator_increment");
+    static const Symbol decrement = Symbol::Intern("__operator_decrement");
+
+    switch (operator_)
+    {
+        case OperatorType::Plus:
+            return plus;
+        case OperatorType::Minus:
+            return minus;
+        case OperatorType::Multiply:
+            return multiply;
+        case OperatorType::Divide:
+            return divide;
+        case OperatorType::Less:
+            return less;
+        case OperatorType::Greater:
+            return greater;
+        case OperatorType::Equal:
+            return equal;
+        case OperatorType::NotEqual:
+            return notEqual;
+        case OperatorType::GreaterOrEqual:
+            return greaterOrEqual;
+        case OperatorType::LessOrEqual:
+            return lessOrEqual;
+        case OperatorType::Not:
+            return not_;
+        case OperatorType::UnaryMinus:
+            return minus;
+        case OperatorType::UnaryPlus:
+            return plus;
+        case OperatorType::Increment:
+            return increment;
+        case OperatorType::Decrement:
+            return decrement;
+        default: ;
+    }
+    return {};
+}
+
 DataType ClassDeclNode::ToDataType() const
 {
     DataType type{ DataType::TypeT::Complex };
@@ -38,7 +38,7 @@ struct MethodArguments final : NodeSeq<MethodArguments, VarDeclNode>
 struct MethodArgumentDto
 {
     DataType Type;
-    std::string Name;
+    Symbol Name;
 };
 
 inline std::vector<DataType> ToTypes(std::vector<MethodArgumentDto> const& arguments)
@@ -52,7 +52,7 @@ inline MethodArgumentDto ToMethodArgumentDto(VarDeclNode* node)
 {
     return {
         ToDataType(node->VarType),
-        std::string{ node->Identifier }
+        node->Identifier
     };
 }
 
@@ -75,6 +75,9 @@ enum class OperatorType
     Decrement
 };
 
+// Method name of the overload of the operator
+[[nodiscard]] Symbol OperatorIdentifier(OperatorType operator_);
+
 inline OperatorType ToOperatorOverload(const ExprNode::TypeT type)
 {
     // ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
@@ -120,13 +123,17 @@ struct MethodDeclNode final : Node
     const VisibilityModifier Visibility{};
     const TypeNode* Type{};
 private:
-    std::string_view _identifier{};
+    Symbol _identifier{};
 public:
     MethodArguments* Arguments{};
     StmtSeqNode* Body{};
     const bool IsStatic{};
     const bool IsConstructor{};
     std::vector<VarDeclNode*> Variables{};
+    // Lowest local variable slot no variable in scope holds
+    int NextFreeSlot = 0;
+    // Local variable slots the method needs at most, slots of variables out of scope are reused
+    int LocalsCount = 0;
     DataType AReturnType{};
     std::vector<MethodArgumentDto> ArgumentDtos{};
 
@@ -135,7 +142,7 @@ public:
     bool IsOperatorOverload = false;
     OperatorType Operator{};
 
-    VarDeclNode* FindVariableByName(std::string_view var, int scopingLevel)
+    VarDeclNode* FindVariableByName(const Symbol var, int scopingLevel)
     {
         for (auto* variable : Variables)
         {
@@ -145,7 +152,7 @@ public:
         return nullptr;
     }
 
-    MethodDeclNode(const VisibilityModifier visibility, const TypeNode* const type, const std::string_view identifier,
+    MethodDeclNode(const VisibilityModifier visibility, const TypeNode* const type, const Symbol identifier,
                    MethodArguments* const arguments, StmtSeqNode* const body, const bool isStatic = false)
         : Visibility{ visibility }
       , Type{ type }
@@ -200,46 +207,12 @@ public:
                        ToMethodArgumentDto);
     }
 
-    [[nodiscard]] std::string Identifier() const
+    // Name of the method in the class file, operator overloads get a reserved one
+    [[nodiscard]] Symbol Identifier() const
     {
         if (!IsOperatorOverload)
-            return std::string{ _identifier };
-
-        switch (Operator)
-        {
-            case OperatorType::Plus:
-                return "__operator_plus";
-            case OperatorType::Minus:
-                return "__operator_minus";
-            case OperatorType::Multiply:
-                return "__operator_multiply";
-            case OperatorType::Divide:
-                return "__operator_divide";
-            case OperatorType::Less:
-                return "__operator_less";
-            case OperatorType::Greater:
-                return "__operator_greater";
-            case OperatorType::Equal:
-                return "__operator_equal";
-            case OperatorType::NotEqual:
-                return "__operator_not_equal";
-            case OperatorType::GreaterOrEqual:
-                return "__operator_greater_or_equal";
-            case OperatorType::LessOrEqual:
-                return "__operator_less_or_equal";
-            case OperatorType::Not:
-                return "__operator_not";
-            case OperatorType::UnaryMinus:
-                return "__operator_minus";
-            case OperatorType::UnaryPlus:
-                return "__operator_plus";
-            case OperatorType::Increment:
-                return "__operator_increment";
-            case OperatorType::Decrement:
-                return "__operator_decrement";
-            default: ;
-        }
-        return {};
+            return _identifier;
+        return OperatorIdentifier(Operator);
     }
 
     friend struct ClassAnalyzer;
@@ -262,7 +235,7 @@ struct NamespaceDeclNode;
 
 struct ClassDeclNode final : Node
 {
-    std::string_view ClassName;
+    Symbol ClassName;
     IdentifierList* ParentType;
     ClassMembersNode* Members;
     NamespaceDeclNode* Namespace{};
@@ -271,7 +244,7 @@ struct ClassDeclNode final : Node
 
     [[nodiscard]] DataType ToDataType() const;
 
-    [[nodiscard]] FieldDeclNode* FindFieldByName(std::string_view name) const
+    [[nodiscard]] FieldDeclNode* FindFieldByName(const Symbol name) const
     {
         for (auto* field : Members->Fields)
         {
@@ -282,7 +255,7 @@ struct ClassDeclNode final : Node
     }
 
 
-    ClassDeclNode(const std::string_view className, IdentifierList* parentType, ClassMembersNode* const members)
+    ClassDeclNode(const Symbol className, IdentifierList* parentType, ClassMembersNode* const members)
         : ClassName{ className }
       , ParentType{ parentType }
       , Members{ members }
@@ -182,6 +182,11 @@ inline bool IsComparison(const ExprNode::TypeT type)
     }
 }
 
+inline bool IsEquality(const ExprNode::TypeT type)
+{
+    return type == ExprNode::TypeT::Equal || type == ExprNode::TypeT::NotEqual;
+}
+
 inline bool IsLogical(const ExprNode::TypeT type)
 {
     switch (type) // NOLINT(clang-diagnostic-switch-enum)
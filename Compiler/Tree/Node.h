@@ -1,6 +1,10 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
 #include <string_view>
 #include <vector>
+#include "NodeArena.h"
+#include "Symbol.h"
 
 struct Node
 {
@@ -9,6 +13,8 @@ struct Node
 
     Node() : Id{ NextId() }
     {
+        if (auto* arena = NodeArena::Current())
+            arena->Track(this);
     }
 
     Node(const Node& other) = delete;
@@ -21,12 +27,18 @@ struct Node
 
     virtual ~Node() = default;
 
+    // Nodes live in the current NodeArena when there is one, see NodeArena.h
+    static void* operator new(size_t size);
+
+    static void operator delete(void* pointer) noexcept;
+
     [[nodiscard]] virtual std::string_view Name() const noexcept = 0;
 
 protected:
+    // Nodes may be created from several threads
     static IdType NextId()
     {
-        static IdType id = 0;
+        static std::atomic<IdType> id = 0;
         return id++;
     }
 };
@@ -54,7 +66,7 @@ protected:
 
 struct IdentifierList
 {
-    std::vector<std::string_view> Identifiers;
+    std::vector<Symbol> Identifiers;
 
-    void Add(std::string_view el) { Identifiers.push_back(el); }
+    void Add(const Symbol el) { Identifiers.push_back(el); }
 };
@@ -0,0 +1,61 @@
+#include "NodeArena.h"
+#include <algorithm>
+#include <new>
+#include "Node.h"
+
+thread_local NodeArena* NodeArena::current = nullptr;
+
+NodeArena::~NodeArena()
+{
+    for (auto node = Nodes.rbegin(); node != Nodes.rend(); ++node) { (*node)->~Node(); }
+}
+
+void* NodeArena::Allocate(size_t size)
+{
+    constexpr auto alignment = alignof(std::max_align_t);
+    size = (size + alignment - 1) / alignment * alignment;
+    if (size > FreeSize)
+    {
+        if (size > BlockSize / 4)
+        {
+            // A block of its own, the free tail of the current block stays usable
+            Blocks.push_back(std::make_unique<std::byte[]>(size));
+            Allocated += size;
+            return Blocks.back().get();
+        }
+        Blocks.push_back(std::make_unique<std::byte[]>(BlockSize));
+        Free = Blocks.back().get();
+        FreeSize = BlockSize;
+    }
+    auto* result = Free;
+    Free += size;
+    FreeSize -= size;
+    Allocated += size;
+    return result;
+}
+
+void NodeArena::Forget(const void* node)
+{
+    // The node is one of the last ones created
+    const auto found = std::find_if(Nodes.rbegin(), Nodes.rend(), [&](auto* tracked)
+    {
+        return static_cast<const void*>(tracked) == node;
+    });
+    if (found != Nodes.rend())
+        Nodes.erase(std::next(found).base());
+}
+
+void* Node::operator new(const size_t size)
+{
+    if (auto* arena = NodeArena::Current())
+        return arena->Allocate(size);
+    return ::operator new(size);
+}
+
+void Node::operator delete(void* pointer) noexcept
+{
+    if (auto* arena = NodeArena::Current())
+        arena->Forget(pointer);
+    else
+        ::operator delete(pointer);
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+struct Node;
+
+// Bump allocator for the syntax tree of one compilation. Nodes are carved from large blocks one after
+// another, and the whole tree is destroyed and freed at once together with the arena.
+// `new` of any node uses the arena made current on this thread by NodeArena::Scope
+class NodeArena
+{
+public:
+    NodeArena() = default;
+
+    NodeArena(const NodeArena& other) = delete;
+
+    NodeArena& operator=(const NodeArena& other) = delete;
+
+    // Destroys the nodes in the reverse order of creation, then frees the blocks
+    ~NodeArena();
+
+    [[nodiscard]] void* Allocate(size_t size);
+
+    // Called by the node constructor, so the arena can run the destructor later
+    void Track(Node* node) { Nodes.push_back(node); }
+
+    // Called when a node constructor throws: the node is already destroyed, its memory is simply left unused
+    void Forget(const void* node);
+
+    [[nodiscard]] size_t AllocatedBytes() const { return Allocated; }
+
+    [[nodiscard]] static NodeArena* Current() { return current; }
+
+    // Makes the arena current on this thread until the end of the scope
+    struct Scope
+    {
+        explicit Scope(NodeArena& arena) : Previous{ current } { current = &arena; }
+
+        Scope(const Scope& other) = delete;
+
+        Scope& operator=(const Scope& other) = delete;
+
+        ~Scope() { current = Previous; }
+
+    private:
+        NodeArena* Previous;
+    };
+
+private:
+    // Most trees fit in a few blocks, bigger requests get a block of their own
+    static constexpr size_t BlockSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<std::byte[]>> Blocks;
+    std::byte* Free = nullptr;
+    size_t FreeSize = 0;
+    size_t Allocated = 0;
+    std::vector<Node*> Nodes;
+
+    static thread_local NodeArena* current;
+};
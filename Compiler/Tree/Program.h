@@ -19,11 +19,11 @@ struct NamespaceMembersNode final : Node
 
 struct NamespaceDeclNode final : Node
 {
-    std::string_view NamespaceName;
+    Symbol NamespaceName;
     NamespaceMembersNode* Members;
 
 
-    NamespaceDeclNode(const std::string_view namespaceName, NamespaceMembersNode* const members)
+    NamespaceDeclNode(const Symbol namespaceName, NamespaceMembersNode* const members)
         : NamespaceName{ namespaceName }
       , Members{ members }
     {
@@ -6,8 +6,8 @@
 struct VarDeclNode final : Node
 {
     TypeNode* VarType{};
-    std::string_view Identifier{};
-    std::string_view InitialName{};
+    Symbol Identifier{};
+    Symbol InitialName{};
     ExprNode* InitExpr{};
 
     DataType AType{};
@@ -17,7 +17,7 @@ struct VarDeclNode final : Node
 
     bool ShouldDeduceType = false;
 
-    VarDeclNode(TypeNode* const varType, const char* const identifier, ExprNode* const initExpr,
+    VarDeclNode(TypeNode* const varType, const Symbol identifier, ExprNode* const initExpr,
                 bool deduceType = false)
         : VarType{ varType }
       , Identifier{ identifier }
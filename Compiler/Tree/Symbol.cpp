@@ -0,0 +1,104 @@
+#include "Symbol.h"
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    class SymbolTable
+    {
+    public:
+        const Symbol::Entry* Intern(const std::string_view text)
+        {
+            std::lock_guard lock{ mutex };
+            if (const auto found = entries.find(text); found != entries.end())
+                return found->second;
+
+            if (text.size() > UINT32_MAX || entryList.size() == UINT32_MAX - 1)
+                throw std::runtime_error{ "Too many or too long identifiers" };
+            auto* copy = Allocate(text.size() + 1);
+            text.copy(copy, text.size());
+            copy[text.size()] = '\0';
+            auto const& entry = entryList.emplace_back(
+                Symbol::Entry{ (SymbolId)entryList.size() + 1, (uint32_t)text.size(), copy });
+            entries.emplace(std::string_view{ copy, text.size() }, &entry);
+            return &entry;
+        }
+
+        size_t Count()
+        {
+            std::lock_guard lock{ mutex };
+            return entryList.size();
+        }
+
+        size_t TextBytes()
+        {
+            std::lock_guard lock{ mutex };
+            return textBytes;
+        }
+
+    private:
+        // Spellings are copied one after another into blocks of this size, longer ones get a block of their own
+        static constexpr size_t BlockSize = 64 * 1024;
+
+        std::mutex mutex;
+        std::unordered_map<std::string_view, const Symbol::Entry*> entries;
+        // Entries never move, symbols point to them
+        std::deque<Symbol::Entry> entryList;
+        std::vector<std::unique_ptr<char[]>> blocks;
+        char* free = nullptr;
+        size_t freeSize = 0;
+        size_t textBytes = 0;
+
+        char* Allocate(const size_t size)
+        {
+            textBytes += size;
+            if (size > BlockSize / 4)
+            {
+                blocks.push_back(std::make_unique<char[]>(size));
+                return blocks.back().get();
+            }
+            if (size > freeSize)
+            {
+                blocks.push_back(std::make_unique<char[]>(BlockSize));
+                free = blocks.back().get();
+                freeSize = BlockSize;
+            }
+            auto* result = free;
+            free += size;
+            freeSize -= size;
+            return result;
+        }
+    };
+
+    // Constructed on first use, so constants interned during static initialization can use it
+    SymbolTable& Table()
+    {
+        static SymbolTable table;
+        return table;
+    }
+}
+
+Symbol Symbol::Intern(const std::string_view text)
+{
+    if (text.empty())
+        return {};
+    // Each thread remembers the entries it got, so a spelling repeated in a source takes the lock only once.
+    // The keys view the table's copies, which live as long as the program
+    thread_local std::unordered_map<std::string_view, const Entry*> seen;
+    if (const auto found = seen.find(text); found != seen.end())
+        return found->second;
+    const auto* entry = Table().Intern(text);
+    seen.emplace(std::string_view{ entry->Text, entry->Length }, entry);
+    return entry;
+}
+
+size_t Symbol::Count() { return Table().Count(); }
+
+size_t Symbol::TextBytes() { return Table().TextBytes(); }
+
+std::ostream& operator<<(std::ostream& out, const Symbol symbol) { return out << symbol.Text(); }
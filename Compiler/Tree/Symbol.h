@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+using SymbolId = uint32_t;
+
+// Spelling of an identifier or a literal, interned in the global symbol table. Every distinct spelling is stored
+// once and gets its own id, so two symbols are compared as integers instead of strings.
+// A default-constructed symbol is the empty spelling. Symbols stay valid until the program ends
+class Symbol
+{
+public:
+    struct Entry
+    {
+        SymbolId Id;
+        uint32_t Length;
+        // Null-terminated
+        const char* Text;
+    };
+
+    Symbol() = default;
+
+    // The parser passes symbols around as entries, its value union can only hold trivial types
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    Symbol(const Entry* entry) : entry{ entry }
+    {
+    }
+
+    [[nodiscard]] const Entry* GetEntry() const { return entry; }
+
+    // Finds or adds the spelling, safe to call from several threads. Only the first lookup of a spelling
+    // on a thread locks the table
+    [[nodiscard]] static Symbol Intern(std::string_view text);
+
+    // Ids go from 1 in the order of first interning, 0 is the empty spelling
+    [[nodiscard]] SymbolId Id() const { return entry ? entry->Id : 0; }
+
+    [[nodiscard]] std::string_view Text() const
+    {
+        return entry ? std::string_view{ entry->Text, entry->Length } : std::string_view{};
+    }
+
+    [[nodiscard]] const char* CStr() const { return entry ? entry->Text : ""; }
+
+    [[nodiscard]] bool IsEmpty() const { return entry == nullptr; }
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    operator std::string_view() const { return Text(); }
+
+    bool operator==(const Symbol other) const { return entry == other.entry; }
+
+    bool operator!=(const Symbol other) const { return entry != other.entry; }
+
+    // Compares the spelling, for names that are not interned yet
+    bool operator==(const std::string_view text) const { return Text() == text; }
+
+    bool operator!=(const std::string_view text) const { return Text() != text; }
+
+    // Interned symbols in the table, for the memory statistics
+    [[nodiscard]] static size_t Count();
+
+    // Bytes the table keeps for the spellings
+    [[nodiscard]] static size_t TextBytes();
+
+private:
+    const Entry* entry = nullptr;
+};
+
+// Spelling as a std::string, for building messages and names
+[[nodiscard]] inline std::string ToString(const Symbol symbol) { return std::string{ symbol.Text() }; }
+
+std::ostream& operator<<(std::ostream& out, Symbol symbol);
+
+template <>
+struct std::hash<Symbol>
+{
+    size_t operator()(const Symbol symbol) const noexcept { return symbol.Id(); }
+};
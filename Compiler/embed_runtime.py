@@ -0,0 +1,34 @@
+# Regenerates Semantic/RuntimeLibrary.cpp from the compiled runtime library,
+# run it after rebuilding the classes in "Runtime Library/Binary"
+import os
+
+BINARY_DIR = os.path.join("Runtime Library", "Binary")
+OUTPUT_FILENAME = os.path.join("Semantic", "RuntimeLibrary.cpp")
+BYTES_PER_LINE = 16
+
+class_files = []
+for root, _, files in os.walk(BINARY_DIR):
+    for name in files:
+        if name.endswith(".class"):
+            path = os.path.join(root, name)
+            class_files.append((os.path.relpath(path, BINARY_DIR).replace(os.sep, "/"), path))
+class_files.sort()
+
+content = "// Generated by embed_runtime.py from the classes in \"Runtime Library/Binary\", do not edit\n"
+content += "#include \"RuntimeLibrary.h\"\n\nnamespace\n{\n"
+for index, (_, path) in enumerate(class_files):
+    with open(path, "rb") as class_file:
+        data = class_file.read()
+    content += "    constexpr unsigned char Class%d[] = {\n" % index
+    for start in range(0, len(data), BYTES_PER_LINE):
+        line = data[start:start + BYTES_PER_LINE]
+        content += "        " + ", ".join("0x%02X" % byte for byte in line) + ",\n"
+    content += "    };\n\n"
+content += "}\n\nconst std::vector<RuntimeClass>& RuntimeClasses()\n{\n"
+content += "    static const std::vector<RuntimeClass> classes{\n"
+for index, (name, _) in enumerate(class_files):
+    content += "        { \"%s\", Class%d, sizeof Class%d },\n" % (name, index, index)
+content += "    };\n    return classes;\n}\n"
+
+with open(OUTPUT_FILENAME, "w", newline="\n") as output_file:
+    output_file.write(content)